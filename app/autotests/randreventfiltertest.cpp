@@ -0,0 +1,164 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "randreventfilter.h"
+
+// C++
+#include <cstring>
+
+// Qt
+#include <QElapsedTimer>
+#include <QTest>
+
+// X11
+#include <xcb/xcb.h>
+#include <xcb/randr.h>
+
+using namespace Latte;
+
+//! timers are allowed to fire a bit late under load
+static const int TIMERTOLERANCE = 100;
+
+//! any value works, real servers report the one of their RandR extension
+static const int RANDREVENTBASE = 89;
+
+class RandrEventFilterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void defaults();
+    void screenChangeIsReported();
+    void syntheticScreenChangeIsReported();
+    void otherEventsAreIgnored();
+    void otherEventTypesAreIgnored();
+    void missingRandrIgnoresEverything();
+    void burstIsCoalesced();
+
+private:
+    bool filter(const int &responseType, const QByteArray &eventType = "xcb_generic_event_t");
+
+private:
+    RandrEventFilter *m_filter{nullptr};
+
+    QElapsedTimer m_clock;
+    QList<qint64> m_changesAt;
+};
+
+bool RandrEventFilterTest::filter(const int &responseType, const QByteArray &eventType)
+{
+    xcb_generic_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.response_type = (uint8_t)responseType;
+
+    long result{0};
+    return m_filter->nativeEventFilter(eventType, &event, &result);
+}
+
+void RandrEventFilterTest::init()
+{
+    m_changesAt.clear();
+
+    m_filter = new RandrEventFilter(RANDREVENTBASE, this);
+    m_clock.start();
+
+    connect(m_filter, &RandrEventFilter::screensChanged, this, [&]() {
+        m_changesAt << m_clock.elapsed();
+    });
+}
+
+void RandrEventFilterTest::cleanup()
+{
+    delete m_filter;
+    m_filter = nullptr;
+}
+
+void RandrEventFilterTest::defaults()
+{
+    QCOMPARE(m_filter->randrEventBase(), RANDREVENTBASE);
+    QCOMPARE(m_filter->burstInterval(), 100);
+    QVERIFY(!m_filter->isBurstPending());
+}
+
+void RandrEventFilterTest::screenChangeIsReported()
+{
+    //! events are never consumed
+    QVERIFY(!filter(RANDREVENTBASE + XCB_RANDR_SCREEN_CHANGE_NOTIFY));
+    QVERIFY(m_filter->isBurstPending());
+    QCOMPARE(m_changesAt.count(), 0);
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_changesAt.count(), 1, m_filter->burstInterval() + TIMERTOLERANCE);
+    QVERIFY(!m_filter->isBurstPending());
+}
+
+void RandrEventFilterTest::syntheticScreenChangeIsReported()
+{
+    //! events sent through SendEvent carry the highest response type bit
+    filter((RANDREVENTBASE + XCB_RANDR_SCREEN_CHANGE_NOTIFY) | 0x80);
+    QVERIFY(m_filter->isBurstPending());
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_changesAt.count(), 1, m_filter->burstInterval() + TIMERTOLERANCE);
+}
+
+void RandrEventFilterTest::otherEventsAreIgnored()
+{
+    QVERIFY(!filter(XCB_MOTION_NOTIFY));
+    QVERIFY(!filter(XCB_PROPERTY_NOTIFY));
+    QVERIFY(!filter(XCB_CONFIGURE_NOTIFY));
+    QVERIFY(!filter(RANDREVENTBASE + XCB_RANDR_NOTIFY));
+    QVERIFY(!filter(RANDREVENTBASE - 1));
+
+    QVERIFY(!m_filter->isBurstPending());
+    QTest::qWait(m_filter->burstInterval() + TIMERTOLERANCE);
+    QCOMPARE(m_changesAt.count(), 0);
+}
+
+void RandrEventFilterTest::otherEventTypesAreIgnored()
+{
+    QVERIFY(!filter(RANDREVENTBASE + XCB_RANDR_SCREEN_CHANGE_NOTIFY, "windows_generic_MSG"));
+    QVERIFY(!m_filter->isBurstPending());
+}
+
+void RandrEventFilterTest::missingRandrIgnoresEverything()
+{
+    delete m_filter;
+    m_filter = new RandrEventFilter(-1, this);
+
+    QVERIFY(!filter(XCB_RANDR_SCREEN_CHANGE_NOTIFY - 1));
+    QVERIFY(!filter(XCB_RANDR_SCREEN_CHANGE_NOTIFY));
+    QVERIFY(!m_filter->isBurstPending());
+}
+
+void RandrEventFilterTest::burstIsCoalesced()
+{
+    qint64 lastEventAt{0};
+
+    //! a screens reconfiguration, notifications mixed with unrelated traffic
+    for (int i=0; i<10; ++i) {
+        filter(RANDREVENTBASE + XCB_RANDR_SCREEN_CHANGE_NOTIFY);
+        filter(XCB_MOTION_NOTIFY);
+        filter(RANDREVENTBASE + XCB_RANDR_NOTIFY);
+        lastEventAt = m_clock.elapsed();
+        QTest::qWait(20);
+        QCOMPARE(m_changesAt.count(), 0);
+    }
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_changesAt.count(), 1, m_filter->burstInterval() + TIMERTOLERANCE);
+
+    //! coarse timers can fire up to 5% earlier
+    qint64 quiet = m_changesAt[0] - lastEventAt;
+    QVERIFY(quiet >= m_filter->burstInterval() * 0.95);
+
+    QTest::qWait(m_filter->burstInterval() + TIMERTOLERANCE);
+    QCOMPARE(m_changesAt.count(), 1);
+}
+
+QTEST_GUILESS_MAIN(RandrEventFilterTest)
+
+#include "randreventfiltertest.moc"
@@ -27,6 +27,21 @@ static const char QUITLATTEACTION[] = "_quit_latte";
 static const char SECTIONACTION[]= "_latte_section";
 static const char SEPARATOR1ACTION[] = "_separator1";
 
+//! context menu state keys, the state is sent through dbus and its layouts related
+//! part is sent only when its version differs from the one the menu already has
+static const char STATEVERSIONKEY[] = "version";
+static const char STATEMEMORYUSAGEKEY[] = "memoryUsage";
+static const char STATEACTIVELAYOUTSKEY[] = "activeLayouts";
+static const char STATECURRENTLAYOUTSKEY[] = "currentLayouts";
+static const char STATEACTIONSALWAYSSHOWNKEY[] = "actionsAlwaysShown";
+static const char STATEMENULAYOUTSKEY[] = "menuLayouts";
+static const char STATEMENULAYOUTSICONSKEY[] = "menuLayoutsIcons";
+static const char STATEMENULAYOUTSBACKGROUNDICONSKEY[] = "menuLayoutsBackgroundIcons"; /*layouts whose icon is a background file*/
+static const char STATEVIEWLAYOUTKEY[] = "viewLayout";
+static const char STATEVIEWTYPEKEY[] = "viewType";
+static const char STATEVIEWISCLONEDKEY[] = "viewIsCloned";
+static const char STATEVIEWCLONESCOUNTKEY[] = "viewClonesCount";
+
 static QStringList ACTIONSEDITORDER = {LAYOUTSACTION,
                                        PREFERENCESACTION,
                                        QUITLATTEACTION,
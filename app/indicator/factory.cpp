@@ -8,6 +8,9 @@
 // local
 #include "../layouts/importer.h"
 
+// C++
+#include <algorithm>
+
 // Qt
 #include <QDebug>
 #include <QDialogButtonBox>
@@ -24,7 +27,6 @@
 #include <KLocalizedString>
 #include <KMessageBox>
 #include <KNotification>
-#include <KPluginMetaData>
 #include <KArchive/KTar>
 #include <KArchive/KZip>
 #include <KArchive/KArchiveEntry>
@@ -37,8 +39,6 @@ namespace Indicator {
 Factory::Factory(QObject *parent)
     : QObject(parent)
 {
-    m_parentWidget = new QWidget();
-
     m_mainPaths = Latte::Layouts::Importer::standardPaths();
 
     for(int i=0; i<m_mainPaths.count(); ++i) {
@@ -68,12 +68,14 @@ Factory::Factory(QObject *parent)
         }
     });
 
-    qDebug() << m_plugins["org.kde.latte.default"].name();
+    qDebug() << metadata("org.kde.latte.default").name();
 }
 
 Factory::~Factory()
 {
-    m_parentWidget->deleteLater();
+    if (m_parentWidget) {
+        m_parentWidget->deleteLater();
+    }
 }
 
 bool Factory::pluginExists(QString id) const
@@ -104,7 +106,7 @@ QStringList Factory::customLocalPluginIds()
 KPluginMetaData Factory::metadata(QString pluginId)
 {
     if (m_plugins.contains(pluginId)) {
-        return m_plugins[pluginId];
+        return m_plugins[pluginId].metadata;
     }
 
     return KPluginMetaData();
@@ -112,76 +114,108 @@ KPluginMetaData Factory::metadata(QString pluginId)
 
 void Factory::reload(const QString &indicatorPath)
 {
-    QString pluginChangedId;
-
-    if (!indicatorPath.isEmpty() && indicatorPath != "." && indicatorPath != "..") {
-        QString metadataFile = indicatorPath + "/metadata.desktop";
-
-        if(QFileInfo(metadataFile).exists()) {
-            KPluginMetaData metadata = KPluginMetaData::fromDesktopFile(metadataFile);
-
-            if (metadataAreValid(metadata)) {
-                pluginChangedId = metadata.pluginId();
-                QString uiFile = indicatorPath + "/package/" + metadata.value("X-Latte-MainScript");
-
-                if (!m_plugins.contains(metadata.pluginId())) {
-                    m_plugins[metadata.pluginId()] = metadata;
-                }
-
-                if (QFileInfo(uiFile).exists()) {
-                    m_pluginUiPaths[metadata.pluginId()] = QFileInfo(uiFile).absolutePath();
-                }
-
-                if ((metadata.pluginId() != "org.kde.latte.default")
-                        && (metadata.pluginId() != "org.kde.latte.plasma")
-                        && (metadata.pluginId() != "org.kde.latte.plasmatabstyle")) {
-
-                    //! find correct alphabetical position
-                    int newPos = -1;
-
-                    if (!m_customPluginIds.contains(metadata.pluginId())) {
-                        for (int i=0; i<m_customPluginNames.count(); ++i) {
-                            if (QString::compare(metadata.name(), m_customPluginNames[i], Qt::CaseInsensitive)<=0) {
-                                newPos = i;
-                                break;
-                            }
-                        }
-                    }
-
-                    if (!m_customPluginIds.contains(metadata.pluginId())) {
-                        if (newPos == -1) {
-                            m_customPluginIds << metadata.pluginId();
-                        } else {
-                            m_customPluginIds.insert(newPos, metadata.pluginId());
-                        }
-                    }
-
-                    if (!m_customPluginNames.contains(metadata.name())) {
-                        if (newPos == -1) {
-                            m_customPluginNames << metadata.name();
-                        } else {
-                            m_customPluginNames.insert(newPos, metadata.name());
-                        }
-                    }
-                }
-
-                if (indicatorPath.startsWith(QDir::homePath())) {
-                    m_customLocalPluginIds << metadata.pluginId();
-                }
-            }
+    if (indicatorPath.isEmpty() || indicatorPath == "." || indicatorPath == "..") {
+        return;
+    }
+
+    QString metadataFile = indicatorPath + "/metadata.desktop";
+    QFileInfo metadataInfo(metadataFile);
+
+    if (!metadataInfo.exists()) {
+        return;
+    }
+
+    QDateTime packageModified = QFileInfo(indicatorPath + "/package").lastModified();
+
+    if (m_pathPluginIds.contains(indicatorPath)) {
+        const PluginRecord &record = m_plugins[m_pathPluginIds[indicatorPath]];
+
+        if (record.metadataModified == metadataInfo.lastModified() && record.packageModified == packageModified) {
+            //! nothing that matters changed for this indicator
+            return;
+        }
+    }
+
+    KPluginMetaData metadata = KPluginMetaData::fromDesktopFile(metadataFile);
+
+    if (!metadataAreValid(metadata)) {
+        return;
+    }
+
+    QString pluginId = metadata.pluginId();
+
+    if (m_pathPluginIds.contains(indicatorPath) && m_pathPluginIds[indicatorPath] != pluginId) {
+        //! the indicator in this path changed its id
+        QString previousId = m_pathPluginIds[indicatorPath];
+        m_plugins.remove(previousId);
+        m_customLocalPluginIds.removeAll(previousId);
+        emit indicatorRemoved(previousId);
+    }
+
+    bool isNew = !m_plugins.contains(pluginId);
+
+    if (!isNew && m_plugins[pluginId].path != indicatorPath) {
+        //! plugin is already provided from another path with higher priority
+        return;
+    }
+
+    PluginRecord record;
+    record.metadata = metadata;
+    record.path = indicatorPath;
+    record.metadataModified = metadataInfo.lastModified();
+    record.packageModified = packageModified;
+
+    QString uiFile = indicatorPath + "/package/" + metadata.value("X-Latte-MainScript");
+
+    if (QFileInfo(uiFile).exists()) {
+        record.uiPath = QFileInfo(uiFile).absolutePath();
+    }
+
+    m_plugins[pluginId] = record;
+    m_pathPluginIds[indicatorPath] = pluginId;
+
+    if (indicatorPath.startsWith(QDir::homePath()) && !m_customLocalPluginIds.contains(pluginId)) {
+        m_customLocalPluginIds << pluginId;
+    }
 
-            qDebug() << " Indicator Package Loaded ::: " << metadata.name() << " [" << metadata.pluginId() << "]" << " - [" << indicatorPath <<"]";
+    qDebug() << " Indicator Package Loaded ::: " << metadata.name() << " [" << pluginId << "]" << " - [" << indicatorPath <<"]";
 
-            /*qDebug() << " Indicator value ::: " << metadata.pluginId();
-                            qDebug() << " Indicator value ::: " << metadata.fileName();
-                            qDebug() << " Indicator value ::: " << metadata.value("X-Latte-MainScript");
-                            qDebug() << " Indicator value ::: " << metadata.value("X-Latte-ConfigUi");
-                            qDebug() << " Indicator value ::: " << metadata.value("X-Latte-ConfigXml");*/
+    if (isNew) {
+        updateCustomPluginsLists();
+    }
+
+    if (m_pendingRemovedPluginIds.contains(pluginId)) {
+        //! it was removed and added back, e.g. updated from the store
+        m_pendingRemovedPluginIds.removeAll(pluginId);
+        emit indicatorChanged(pluginId);
+    } else if (isNew) {
+        emit indicatorAdded(pluginId);
+    } else {
+        emit indicatorChanged(pluginId);
+    }
+}
+
+void Factory::updateCustomPluginsLists()
+{
+    QList<KPluginMetaData> customs;
+
+    for (const auto &record : m_plugins) {
+        if (isCustomType(record.metadata.pluginId())) {
+            customs << record.metadata;
         }
     }
 
-    if (!pluginChangedId.isEmpty()) {
-        emit indicatorChanged(pluginChangedId);
+    //! alphabetical order based on indicators names
+    std::sort(customs.begin(), customs.end(), [](const KPluginMetaData &a, const KPluginMetaData &b) {
+        return QString::compare(a.name(), b.name(), Qt::CaseInsensitive) < 0;
+    });
+
+    m_customPluginIds.clear();
+    m_customPluginNames.clear();
+
+    for (const auto &metadata : customs) {
+        m_customPluginIds << metadata.pluginId();
+        m_customPluginNames << metadata.name();
     }
 }
 
@@ -207,26 +241,39 @@ void Factory::discoverNewIndicators(const QString &main)
 
 void Factory::removeIndicatorRecords(const QString &path)
 {
-    if (m_indicatorsPaths.contains(path)) {
-        QString pluginId =  path.section('/',-1);
-        m_plugins.remove(pluginId);
-        m_pluginUiPaths.remove(pluginId);
+    if (!m_indicatorsPaths.contains(path)) {
+        return;
+    }
 
-        int pos = m_customPluginIds.indexOf(pluginId);
+    m_indicatorsPaths.removeAll(path);
+    KDirWatch::self()->removeDir(path);
+
+    if (!m_pathPluginIds.contains(path)) {
+        return;
+    }
 
-        m_customPluginIds.removeAt(pos);
-        m_customPluginNames.removeAt(pos);
-        m_customLocalPluginIds.removeAll(pluginId);
+    QString pluginId = m_pathPluginIds.take(path);
+    m_plugins.remove(pluginId);
+    m_customLocalPluginIds.removeAll(pluginId);
 
-        m_indicatorsPaths.removeAll(path);
+    updateCustomPluginsLists();
 
-        KDirWatch::self()->removeDir(path);
+    m_pendingRemovedPluginIds << pluginId;
 
-        //! delay informing the removal in case it is just an update
-        QTimer::singleShot(1000, [this, pluginId]() {
-            emit indicatorRemoved(pluginId);
-        });
+    //! an indicator with the same id may still be provided from another path
+    for (const auto &iPath : m_indicatorsPaths) {
+        if (!m_pathPluginIds.contains(iPath)) {
+            reload(iPath);
+        }
     }
+
+    //! delay informing the removal in case it is just an update
+    QTimer::singleShot(1000, this, [this, pluginId]() {
+        if (m_pendingRemovedPluginIds.contains(pluginId)) {
+            m_pendingRemovedPluginIds.removeAll(pluginId);
+            emit indicatorRemoved(pluginId);
+        }
+    });
 }
 
 bool Factory::isCustomType(const QString &id) const
@@ -253,11 +300,11 @@ bool Factory::metadataAreValid(QString &file)
 
 QString Factory::uiPath(QString pluginName) const
 {
-    if (!m_pluginUiPaths.contains(pluginName)) {
+    if (!m_plugins.contains(pluginName)) {
         return "";
     }
 
-    return m_pluginUiPaths[pluginName];
+    return m_plugins[pluginName].uiPath;
 }
 
 Latte::ImportExport::State Factory::importIndicatorFile(QString compressedFile)
@@ -348,7 +395,7 @@ Latte::ImportExport::State Factory::importIndicatorFile(QString compressedFile)
 void Factory::removeIndicator(QString id)
 {
     if (m_plugins.contains(id)) {
-        QString pluginName = m_plugins[id].name();
+        QString pluginName = m_plugins[id].metadata.name();
 
         QDialog* dialog = new QDialog(nullptr);
         dialog->setWindowTitle(i18n("Remove Indicator Confirmation"));
@@ -387,6 +434,10 @@ void Factory::removeIndicator(QString id)
 
 void Factory::downloadIndicator()
 {
+    if (!m_parentWidget) {
+        m_parentWidget = new QWidget();
+    }
+
     KNS3::DownloadDialog dialog(QStringLiteral("latte-indicators.knsrc"), m_parentWidget);
 
     dialog.exec();
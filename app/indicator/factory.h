@@ -10,11 +10,13 @@
 #include "../apptypes.h"
 
 // Qt
+#include <QDateTime>
 #include <QHash>
 #include <QObject>
 #include <QWidget>
 
-class KPluginMetaData;
+// KDE
+#include <KPluginMetaData>
 
 namespace Latte {
 namespace Indicator {
@@ -50,18 +52,39 @@ public:
     //! imports an indicator compressed file
     static Latte::ImportExport::State importIndicatorFile(QString compressedFile);
 signals:
+    void indicatorAdded(const QString &indicatorId);
+    //! an already known indicator was updated, e.g. reinstalled from the store
     void indicatorChanged(const QString &indicatorId);
     void indicatorRemoved(const QString &indicatorId);
 
 private:
+    struct PluginRecord
+    {
+        KPluginMetaData metadata;
+        QString path;
+        QString uiPath;
+        //! used to identify whether a directory change updated the indicator
+        QDateTime metadataModified;
+        QDateTime packageModified;
+    };
+
     void reload(const QString &indicatorPath);
 
     void removeIndicatorRecords(const QString &path);
     void discoverNewIndicators(const QString &main);
 
+    //! custom lists are rebuilt only when an indicator is added or removed
+    void updateCustomPluginsLists();
+
 private:
-    QHash<QString, KPluginMetaData> m_plugins;
-    QHash<QString, QString> m_pluginUiPaths;
+    //! registry keyed by plugin id
+    QHash<QString, PluginRecord> m_plugins;
+    //! indicator path to plugin id
+    QHash<QString, QString> m_pathPluginIds;
+
+    //! removed indicators whose removal has not been informed yet,
+    //! if they are added back they are considered updated
+    QStringList m_pendingRemovedPluginIds;
 
     QStringList m_customPluginIds;
     QStringList m_customPluginNames;
@@ -71,7 +94,8 @@ private:
     QStringList m_mainPaths;
     QStringList m_indicatorsPaths;
 
-    QWidget *m_parentWidget;
+    //! created only when KNewStuff dialogs are requested
+    QWidget *m_parentWidget{nullptr};
 };
 
 }
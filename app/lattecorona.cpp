@@ -13,6 +13,7 @@
 #include "apptypes.h"
 #include "lattedockadaptor.h"
 #include "screenpool.h"
+#include "data/contextmenudata.h"
 #include "data/generictable.h"
 #include "data/layouticondata.h"
 #include "declarativeimports/interfaces.h"
@@ -32,7 +33,9 @@
 #include "plasma/extended/theme.h"
 #include "settings/universalsettings.h"
 #include "templates/templatesmanager.h"
+#include "tools/tracer.h"
 #include "view/originalview.h"
+#include "view/helpers/screenedgetriggers.h"
 #include "view/view.h"
 #include "view/settings/viewsettingsfactory.h"
 #include "view/windowstracker/windowstracker.h"
@@ -88,19 +91,31 @@ Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, QString
       m_startupAddViewTemplateName(addViewTemplateName),
       m_userSetMemoryUsage(userSetMemoryUsage),
       m_layoutNameOnStartUp(layoutNameOnStartUp),
-      m_activitiesConsumer(new KActivities::Consumer(this)),
-      m_screenPool(new ScreenPool(KSharedConfig::openConfig(), this)),
-      m_indicatorFactory(new Indicator::Factory(this)),
-      m_universalSettings(new UniversalSettings(KSharedConfig::openConfig(), this)),
-      m_globalShortcuts(new GlobalShortcuts(this)),
-      m_plasmaScreenPool(new PlasmaExtended::ScreenPool(this)),
-      m_themeExtended(new PlasmaExtended::Theme(KSharedConfig::openConfig(), this)),
-      m_viewSettingsFactory(new ViewSettingsFactory(this)),
-      m_templatesManager(new Templates::Manager(this)),
-      m_layoutsManager(new Layouts::Manager(this)),
-      m_plasmaGeometries(new PlasmaExtended::ScreenGeometries(this)),
-      m_dialogShadows(new PanelShadows(this, QStringLiteral("dialogs/background")))
+      m_activitiesConsumer(new KActivities::Consumer(this))
 {
+    m_startupClock.start();
+
+    //! subsystems are created one by one in order to track their startup cost
+    m_screenPool = new ScreenPool(KSharedConfig::openConfig(), this);
+    markStartupStage("screen pool");
+    m_indicatorFactory = new Indicator::Factory(this);
+    markStartupStage("indicators factory");
+    m_universalSettings = new UniversalSettings(KSharedConfig::openConfig(), this);
+    markStartupStage("universal settings");
+    m_globalShortcuts = new GlobalShortcuts(this);
+    markStartupStage("global shortcuts");
+    m_plasmaScreenPool = new PlasmaExtended::ScreenPool(this);
+    markStartupStage("plasma screen pool");
+    m_themeExtended = new PlasmaExtended::Theme(KSharedConfig::openConfig(), this);
+    markStartupStage("extended theme");
+    m_viewSettingsFactory = new ViewSettingsFactory(this);
+    m_templatesManager = new Templates::Manager(this);
+    m_layoutsManager = new Layouts::Manager(this);
+    markStartupStage("layouts and templates managers");
+    m_plasmaGeometries = new PlasmaExtended::ScreenGeometries(this);
+    markStartupStage("screen geometries");
+    m_dialogShadows = new PanelShadows(this, QStringLiteral("dialogs/background"));
+
     connect(qApp, &QApplication::aboutToQuit, this, &Corona::onAboutToQuit);
 
     //! create the window manager
@@ -110,11 +125,15 @@ Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, QString
         m_wm = new WindowSystem::XWindowInterface(this);
     }
 
+    m_screenEdgeTriggers = new ViewPart::ScreenEdgeTriggers(this);
+
     setupWaylandIntegration();
+    markStartupStage("window manager");
 
     KPackage::Package package(new Latte::Package(this));
 
     m_screenPool->load();
+    markStartupStage("package and screens");
 
     if (!package.isValid()) {
         qWarning() << staticMetaObject.className()
@@ -129,9 +148,16 @@ Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, QString
     //! universal settings / extendedtheme must be loaded after the package has been set
     m_universalSettings->load();
     m_themeExtended->load();
+    markStartupStage("settings and theme loaded");
 
     qmlRegisterTypes();
 
+    //! fallback in case no view is rendered during startup
+    m_deferredInitializationTimer.setSingleShot(true);
+    m_deferredInitializationTimer.setInterval(5000);
+    connect(&m_deferredInitializationTimer, &QTimer::timeout, this, &Corona::initDeferredSubsystems);
+    m_deferredInitializationTimer.start();
+
     if (m_activitiesConsumer && (m_activitiesConsumer->serviceStatus() == KActivities::Consumer::Running)) {
         load();
     }
@@ -169,6 +195,7 @@ Corona::~Corona()
     m_layoutsManager->unload();*/
 
     m_plasmaGeometries->deleteLater();
+    m_screenEdgeTriggers->deleteLater();
     m_wm->deleteLater();
     m_dialogShadows->deleteLater();
     m_globalShortcuts->deleteLater();
@@ -222,8 +249,20 @@ void Corona::load()
 
         disconnect(m_activitiesConsumer, &KActivities::Consumer::serviceStatusChanged, this, &Corona::load);
 
+        markStartupStage("activities service");
+
+        //! templates are scanned on demand or after the first view frame
         m_templatesManager->init();
         m_layoutsManager->init();
+        markStartupStage("layouts initialized");
+
+        //! context menu data are rebuilt only after changes that affect them
+        connect(m_layoutsManager, &Layouts::Manager::currentLayoutIsSwitching, this, &Corona::onContextMenuDataChanged);
+        connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::centralLayoutsChanged, this, &Corona::onCentralLayoutsChanged);
+        connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::layoutsChanged, this, &Corona::onContextMenuDataChanged);
+        connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::runningActicitiesChanged, this, &Corona::onContextMenuDataChanged);
+        connect(m_activitiesConsumer, &KActivities::Consumer::currentActivityChanged, this, &Corona::onContextMenuDataChanged);
+        connect(m_universalSettings, &UniversalSettings::actionsChanged, this, &Corona::onContextMenuDataChanged);
 
         connect(this, &Corona::availableScreenRectChangedFrom, this, &Plasma::Corona::availableScreenRectChanged);
         connect(this, &Corona::availableScreenRegionChangedFrom, this, &Plasma::Corona::availableScreenRegionChanged);
@@ -266,6 +305,7 @@ void Corona::load()
         }
 
         m_layoutsManager->loadLayoutOnStartup(loadLayoutName);
+        markStartupStage("startup layout loaded");
 
         //! load screens signals such screenGeometryChanged in order to support
         //! plasmoid.screenGeometry properly
@@ -289,6 +329,50 @@ void Corona::load()
     }
 }
 
+void Corona::markStartupStage(const QString &stage)
+{
+    QString record = QString("%1 :: %2 ms").arg(stage).arg(m_startupClock.elapsed());
+    m_startupTimeline << record;
+
+    qDebug() << "Startup Timeline ::" << record;
+}
+
+bool Corona::deferredInitializationFinished() const
+{
+    return m_deferredInitializationFinished;
+}
+
+void Corona::onViewFrameSwapped()
+{
+    auto view = qobject_cast<Latte::View *>(sender());
+
+    if (view) {
+        disconnect(view, &QQuickWindow::frameSwapped, this, &Corona::onViewFrameSwapped);
+    }
+
+    if (m_deferredInitializationFinished || m_firstViewFrameShown) {
+        return;
+    }
+
+    m_firstViewFrameShown = true;
+    markStartupStage("first view frame");
+
+    //! give the event loop some idle time before loading non-essential subsystems
+    m_deferredInitializationTimer.start(1000);
+}
+
+void Corona::initDeferredSubsystems()
+{
+    if (m_deferredInitializationFinished || m_inQuit) {
+        return;
+    }
+
+    m_deferredInitializationFinished = true;
+
+    m_templatesManager->load();
+    markStartupStage("templates loaded");
+}
+
 void Corona::unload()
 {
     qDebug() << "unload: removing containments...";
@@ -456,6 +540,11 @@ ViewSettingsFactory *Corona::viewSettingsFactory() const
     return m_viewSettingsFactory;
 }
 
+ViewPart::ScreenEdgeTriggers *Corona::screenEdgeTriggers() const
+{
+    return m_screenEdgeTriggers;
+}
+
 WindowSystem::AbstractWindowInterface *Corona::wm() const
 {
     return m_wm;
@@ -1167,53 +1256,132 @@ void Corona::showSettingsWindow(int page)
     m_layoutsManager->showLatteSettingsDialog(p);
 }
 
-QStringList Corona::contextMenuData(const uint &containmentId)
+void Corona::onContextMenuDataChanged()
 {
-    QStringList data;
-    Types::ViewType viewType{Types::DockView};
-    auto view = m_layoutsManager->synchronizer()->viewForContainment(containmentId);
+    m_contextMenuDataIsDirty = true;
+}
 
-    if (view) {
-        viewType = view->type();
+void Corona::onCentralLayoutsChanged()
+{
+    //! layouts icons are shown in the context menu
+    for (const auto &layoutName : m_layoutsManager->centralLayoutsNames()) {
+        auto layout = m_layoutsManager->synchronizer()->centralLayout(layoutName);
+
+        if (!layout) {
+            continue;
+        }
+
+        connect(layout, &Layout::AbstractLayout::iconChanged, this, &Corona::onContextMenuDataChanged, Qt::UniqueConnection);
+        connect(layout, &Layout::AbstractLayout::backgroundChanged, this, &Corona::onContextMenuDataChanged, Qt::UniqueConnection);
     }
 
-    data << QString::number((int)m_layoutsManager->memoryUsage()); // Memory Usage
-    data << m_layoutsManager->centralLayoutsNames().join(";;"); // All Active layouts
-    data << m_layoutsManager->synchronizer()->currentLayoutsNames().join(";;"); // All Current layouts
-    data << m_universalSettings->contextMenuActionsAlwaysShown().join(";;");
+    onContextMenuDataChanged();
+}
 
-    QStringList layoutsmenu;
+void Corona::updateContextMenuData()
+{
+    m_contextMenuDataIsDirty = false;
+
+    QVariantMap data;
+
+    data[Data::ContextMenu::STATEMEMORYUSAGEKEY] = (int)m_layoutsManager->memoryUsage();
+    data[Data::ContextMenu::STATEACTIVELAYOUTSKEY] = m_layoutsManager->centralLayoutsNames();
+    data[Data::ContextMenu::STATECURRENTLAYOUTSKEY] = m_layoutsManager->synchronizer()->currentLayoutsNames();
+    data[Data::ContextMenu::STATEACTIONSALWAYSSHOWNKEY] = m_universalSettings->contextMenuActionsAlwaysShown();
+
+    QStringList menulayouts;
+    QStringList menulayoutsicons;
+    QStringList menulayoutsbackgroundicons;
 
     for(const auto &layoutName : m_layoutsManager->synchronizer()->menuLayouts()) {
         if (m_layoutsManager->synchronizer()->centralLayout(layoutName)
                 || m_layoutsManager->memoryUsage() == Latte::MemoryUsage::SingleLayout) {
-            QStringList layoutdata;
             Data::LayoutIcon layouticon = m_layoutsManager->iconForLayout(layoutName);
-            layoutdata << layoutName;
-            layoutdata << QString::number(layouticon.isBackgroundFile);
-            layoutdata << layouticon.name;
-            layoutsmenu << layoutdata.join("**");
+            menulayouts << layoutName;
+            menulayoutsicons << layouticon.name;
+
+            if (layouticon.isBackgroundFile) {
+                menulayoutsbackgroundicons << layoutName;
+            }
         }
     }
 
-    data << layoutsmenu.join(";;");
-    data << (view ? view->layout()->name() : QString());   //Selected View layout*/
+    data[Data::ContextMenu::STATEMENULAYOUTSKEY] = menulayouts;
+    data[Data::ContextMenu::STATEMENULAYOUTSICONSKEY] = menulayoutsicons;
+    data[Data::ContextMenu::STATEMENULAYOUTSBACKGROUNDICONSKEY] = menulayoutsbackgroundicons;
 
-    QStringList viewtype;
-    viewtype << QString::number((int)viewType); //Selected View type
-
-    if (view && view->isOriginal()) { /*View*/
-        auto originalview = qobject_cast<Latte::OriginalView *>(view);
-        viewtype << "0";              //original view
-        viewtype <<  QString::number(originalview->clonesCount());
-    } else if (view && view->isCloned()) {
-        viewtype << "1";              //cloned view
-        viewtype << "0";              //has no clones
+    data[Data::ContextMenu::STATEVERSIONKEY] = m_contextMenuData.value(Data::ContextMenu::STATEVERSIONKEY);
+
+    if (data == m_contextMenuData) {
+        //! nothing changed, the menus can keep using their data
+        return;
+    }
+
+    m_contextMenuDataVersion++;
+    data[Data::ContextMenu::STATEVERSIONKEY] = m_contextMenuDataVersion;
+    m_contextMenuData = data;
+}
+
+QVariantMap Corona::contextMenuState(const uint &containmentId, const uint &knownVersion)
+{
+    if (m_contextMenuDataIsDirty) {
+        updateContextMenuData();
+    }
+
+    QVariantMap state;
+
+    if (knownVersion != m_contextMenuDataVersion) {
+        state = m_contextMenuData;
     } else {
-        viewtype << "0";              //original view
-        viewtype << "0";              //has no clones
+        state[Data::ContextMenu::STATEVERSIONKEY] = m_contextMenuDataVersion;
+    }
+
+    Types::ViewType viewType{Types::DockView};
+    auto view = m_layoutsManager->synchronizer()->viewForContainment(containmentId);
+
+    if (view) {
+        viewType = view->type();
     }
 
+    state[Data::ContextMenu::STATEVIEWLAYOUTKEY] = (view ? view->layout()->name() : QString());
+    state[Data::ContextMenu::STATEVIEWTYPEKEY] = (int)viewType;
+    state[Data::ContextMenu::STATEVIEWISCLONEDKEY] = (view && view->isCloned());
+    state[Data::ContextMenu::STATEVIEWCLONESCOUNTKEY] = (view && view->isOriginal()) ? qobject_cast<Latte::OriginalView *>(view)->clonesCount() : 0;
+
+    return state;
+}
+
+QStringList Corona::contextMenuData(const uint &containmentId)
+{
+    //! deprecated, it is kept for external callers and is built from the cached state
+    QVariantMap state = contextMenuState(containmentId, 0);
+
+    QStringList data;
+    data << QString::number(state[Data::ContextMenu::STATEMEMORYUSAGEKEY].toInt()); // Memory Usage
+    data << state[Data::ContextMenu::STATEACTIVELAYOUTSKEY].toStringList().join(";;"); // All Active layouts
+    data << state[Data::ContextMenu::STATECURRENTLAYOUTSKEY].toStringList().join(";;"); // All Current layouts
+    data << state[Data::ContextMenu::STATEACTIONSALWAYSSHOWNKEY].toStringList().join(";;");
+
+    QStringList layoutsmenu;
+    QStringList menulayouts = state[Data::ContextMenu::STATEMENULAYOUTSKEY].toStringList();
+    QStringList menulayoutsicons = state[Data::ContextMenu::STATEMENULAYOUTSICONSKEY].toStringList();
+    QStringList menulayoutsbackgroundicons = state[Data::ContextMenu::STATEMENULAYOUTSBACKGROUNDICONSKEY].toStringList();
+
+    for (int i=0; i<menulayouts.count(); ++i) {
+        QStringList layoutdata;
+        layoutdata << menulayouts[i];
+        layoutdata << QString::number(menulayoutsbackgroundicons.contains(menulayouts[i]));
+        layoutdata << menulayoutsicons.value(i);
+        layoutsmenu << layoutdata.join("**");
+    }
+
+    data << layoutsmenu.join(";;");
+    data << state[Data::ContextMenu::STATEVIEWLAYOUTKEY].toString();   //Selected View layout*/
+
+    QStringList viewtype;
+    viewtype << QString::number(state[Data::ContextMenu::STATEVIEWTYPEKEY].toInt()); //Selected View type
+    viewtype << (state[Data::ContextMenu::STATEVIEWISCLONEDKEY].toBool() ? "1" : "0");
+    viewtype << QString::number(state[Data::ContextMenu::STATEVIEWCLONESCOUNTKEY].toInt());
     data << viewtype.join(";;");
 
     return data;
@@ -1233,6 +1401,21 @@ QStringList Corona::viewTemplatesData()
     return data;
 }
 
+QStringList Corona::traceEvents()
+{
+    return Latte::Tracer::self()->events();
+}
+
+QStringList Corona::traceLatencies()
+{
+    return Latte::Tracer::self()->latencies();
+}
+
+QStringList Corona::startupTimeline()
+{
+    return m_startupTimeline;
+}
+
 void Corona::addView(const uint &containmentId, const QString &templateId)
 {
     if (containmentId <= 0) {
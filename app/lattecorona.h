@@ -15,8 +15,10 @@
 #include "view/panelshadows_p.h"
 
 // Qt
+#include <QElapsedTimer>
 #include <QObject>
 #include <QTimer>
+#include <QVariantMap>
 
 // Plasma
 #include <Plasma/Corona>
@@ -72,6 +74,9 @@ class Theme;
 namespace Templates {
 class Manager;
 }
+namespace ViewPart {
+class ScreenEdgeTriggers;
+}
 namespace WindowSystem{
 class AbstractWindowInterface;
 }
@@ -134,6 +139,8 @@ public:
     PlasmaExtended::ScreenPool *plasmaScreenPool() const;
     PlasmaExtended::Theme *themeExtended() const;
 
+    ViewPart::ScreenEdgeTriggers *screenEdgeTriggers() const;
+
     WindowSystem::AbstractWindowInterface *wm() const;
 
     PanelShadows *dialogShadows() const;
@@ -148,9 +155,21 @@ public:
     void importLayoutFile(const QString &filepath, const QString &suggestedLayoutName = QString());
     void showSettingsWindow(int page);
 
+    //! the layouts related part of the state is included only when knownVersion is outdated
+    QVariantMap contextMenuState(const uint &containmentId, const uint &knownVersion);
+    //! deprecated, use contextMenuState instead
     QStringList contextMenuData(const uint &containmentId);
     QStringList viewTemplatesData();
 
+    //! tracing data, they are available only when --trace is used
+    QStringList traceEvents();
+    QStringList traceLatencies();
+
+    //! startup timeline, each startup stage with its elapsed time since Corona creation
+    QStringList startupTimeline();
+
+    bool deferredInitializationFinished() const;
+
 public slots:
     void aboutApplication();
     void activateLauncherMenu();
@@ -175,6 +194,8 @@ public slots:
 
     void unload();
 
+    void onViewFrameSwapped();
+
 signals:
     void configurationShown(PlasmaQuick::ConfigView *configView);
     void viewLocationChanged();
@@ -195,10 +216,17 @@ private slots:
     void screenCountChanged();
     void syncLatteViewsToScreens();
 
+    void initDeferredSubsystems();
+
+    void onCentralLayoutsChanged();
+    void onContextMenuDataChanged();
+
 private:
     void cleanConfig();
+    void markStartupStage(const QString &stage);
     void qmlRegisterTypes() const;
     void setupWaylandIntegration();
+    void updateContextMenuData();
 
     bool appletExists(uint containmentId, uint appletId) const;
     bool containmentExists(uint id) const;
@@ -218,10 +246,17 @@ private:
     bool m_inStartup{true}; //! this is used in order to identify when application is still in startup phase
     bool m_inQuit{false}; //! this is used in order to identify when application is in quit phase
     bool m_quitTimedEnded{false}; //! this is used on destructor in order to delay it and slide-out the views
+    bool m_deferredInitializationFinished{false}; //! non-essential subsystems are initialized after the first view frame
+    bool m_firstViewFrameShown{false};
+    bool m_contextMenuDataIsDirty{true};
 
     //!it can be used on startup to change memory usage from command line
     int m_userSetMemoryUsage{ -1};
 
+    //! context menu layouts data, they are rebuilt only after relevant changes
+    uint m_contextMenuDataVersion{0};
+    QVariantMap m_contextMenuData;
+
     QString m_layoutNameOnStartUp;
     QString m_startupAddViewTemplateName;
     QString m_importFullConfigurationFile;
@@ -229,6 +264,10 @@ private:
     QList<KDeclarative::QmlObjectSharedEngine *> m_alternativesObjects;
 
     QTimer m_viewsScreenSyncTimer;
+    QTimer m_deferredInitializationTimer;
+
+    QElapsedTimer m_startupClock;
+    QStringList m_startupTimeline;
 
     KActivities::Consumer *m_activitiesConsumer;
     QPointer<KAboutApplicationDialog> aboutDialog;
@@ -247,6 +286,7 @@ private:
     PlasmaExtended::Theme *m_themeExtended{nullptr};
 
     WindowSystem::AbstractWindowInterface *m_wm{nullptr};
+    ViewPart::ScreenEdgeTriggers *m_screenEdgeTriggers{nullptr};
 
     PanelShadows *m_dialogShadows{nullptr};
 
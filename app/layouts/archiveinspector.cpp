@@ -0,0 +1,148 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "archiveinspector.h"
+
+// Qt
+#include <QDebug>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QTemporaryDir>
+
+// KDE
+#include <KArchive/KTar>
+#include <KArchive/KArchiveDirectory>
+#include <KArchive/KArchiveFile>
+#include <KConfig>
+#include <KConfigGroup>
+
+#define RCFILE "lattedockrc"
+#define APPLETSFILE "lattedock-appletsrc"
+
+namespace Latte {
+namespace Layouts {
+
+QHash<QString, ArchiveManifest> &ArchiveInspector::cache()
+{
+    static QHash<QString, ArchiveManifest> s_manifests;
+    return s_manifests;
+}
+
+ArchiveManifest ArchiveInspector::manifest(const QString &file)
+{
+    QFileInfo fileInfo(file);
+
+    if (!fileInfo.exists()) {
+        return ArchiveManifest();
+    }
+
+    QString path = fileInfo.absoluteFilePath();
+
+    if (cache().contains(path)) {
+        const ArchiveManifest &cached = cache()[path];
+
+        if (cached.fileSize == fileInfo.size() && cached.lastModified == fileInfo.lastModified()) {
+            return cached;
+        }
+    }
+
+    ArchiveManifest inspected = inspect(path);
+    inspected.fileSize = fileInfo.size();
+    inspected.lastModified = fileInfo.lastModified();
+
+    cache()[path] = inspected;
+
+    return inspected;
+}
+
+ArchiveManifest ArchiveInspector::inspect(const QString &file)
+{
+    ArchiveManifest manifest;
+
+    KTar archive(file, QStringLiteral("application/x-tar"));
+    archive.open(QIODevice::ReadOnly);
+
+    //! if the file isnt a tar archive
+    if (!archive.isOpen()) {
+        return manifest;
+    }
+
+    const KArchiveDirectory *rootDir = archive.directory();
+
+    if (!rootDir) {
+        return manifest;
+    }
+
+    manifest.isValid = true;
+
+    for (const auto &name : rootDir->entries()) {
+        const KArchiveEntry *entry = rootDir->entry(name);
+
+        if (entry->isDirectory()) {
+            manifest.rootDirectories << name;
+        } else {
+            manifest.rootFiles << name;
+        }
+    }
+
+    //! only the version markers are extracted, layouts and backgrounds are not touched.
+    //! they are read through KConfig in order to honor the same parsing rules as importer
+    QTemporaryDir tempDir;
+
+    if (!tempDir.isValid()) {
+        return manifest;
+    }
+
+    const KArchiveFile *rcFile = rootDir->file(QStringLiteral(RCFILE));
+    const KArchiveFile *appletsFile = rootDir->file(QStringLiteral(APPLETSFILE));
+
+    if (rcFile) {
+        rcFile->copyTo(tempDir.path());
+    }
+
+    if (appletsFile) {
+        appletsFile->copyTo(tempDir.path());
+    }
+
+    manifest.rcVersion = readVersion(tempDir.filePath(QStringLiteral(RCFILE)), QStringLiteral("UniversalSettings"));
+    manifest.appletsVersion = readVersion(tempDir.filePath(QStringLiteral(APPLETSFILE)), QStringLiteral("LayoutSettings"));
+
+    return manifest;
+}
+
+int ArchiveInspector::readVersion(const QString &file, const QString &group)
+{
+    if (!QFileInfo::exists(file)) {
+        return 0;
+    }
+
+    KConfig config(file, KConfig::SimpleConfig);
+    KConfigGroup settings = KConfigGroup(&config, group);
+
+    return settings.readEntry("version", 1);
+}
+
+bool ArchiveInspector::extractRootFiles(const QString &file, const QStringList &entryNames, const QString &destination)
+{
+    KTar archive(file, QStringLiteral("application/x-tar"));
+    archive.open(QIODevice::ReadOnly);
+
+    if (!archive.isOpen() || !archive.directory()) {
+        return false;
+    }
+
+    for (const auto &name : entryNames) {
+        const KArchiveFile *archiveFile = archive.directory()->file(name);
+
+        if (!archiveFile || !archiveFile->copyTo(destination)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+}
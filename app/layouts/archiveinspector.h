@@ -0,0 +1,60 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef LAYOUTSARCHIVEINSPECTOR_H
+#define LAYOUTSARCHIVEINSPECTOR_H
+
+// Qt
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace Latte {
+namespace Layouts {
+
+//! what is known about a .latterc archive without extracting it
+struct ArchiveManifest
+{
+    bool isValid{false};
+
+    //! root level entries
+    QStringList rootFiles;
+    QStringList rootDirectories;
+
+    //! lattedockrc [UniversalSettings] version, 0 when missing
+    int rcVersion{0};
+    //! lattedock-appletsrc [LayoutSettings] version, 0 when missing
+    int appletsVersion{0};
+
+    //! used to identify whether the archive changed after it was inspected
+    qint64 fileSize{0};
+    QDateTime lastModified;
+};
+
+//! Inspects .latterc tar archives by extracting only the entries that are needed
+//! in order to identify them instead of extracting the whole archive to disk.
+//! Manifests are cached per file so an import flow that checks the same archive
+//! several times, e.g. settings dialog and importer, reads it only once.
+class ArchiveInspector
+{
+public:
+    static ArchiveManifest manifest(const QString &file);
+
+    //! copies only the requested root level file entries to destination directory
+    static bool extractRootFiles(const QString &file, const QStringList &entryNames, const QString &destination);
+
+private:
+    static ArchiveManifest inspect(const QString &file);
+    //! reads [group] version of an extracted rc file, 0 when the file is missing
+    static int readVersion(const QString &file, const QString &group);
+
+    static QHash<QString, ArchiveManifest> &cache();
+};
+
+}
+}
+
+#endif
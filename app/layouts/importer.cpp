@@ -9,6 +9,7 @@
 
 // local
 #include <coretypes.h>
+#include "archiveinspector.h"
 #include "manager.h"
 #include "../lattecorona.h"
 #include "../screenpool.h"
@@ -298,42 +299,36 @@ bool Importer::importOldConfiguration(QString oldConfigPath, QString newName)
         return false;
     }
 
-    KTar archive(oldConfigPath, QStringLiteral("application/x-tar"));
-    archive.open(QIODevice::ReadOnly);
+    ArchiveManifest manifest = ArchiveInspector::manifest(oldConfigPath);
 
-    if (!archive.isOpen()) {
+    if (!manifest.isValid) {
+        return false;
+    }
+
+    for(const auto &name : manifest.rootFiles) {
+        if (name != QLatin1String("lattedockrc") && name != QLatin1String("lattedock-appletsrc")) {
+            qInfo() << i18nc("import/export config", "The file has a wrong format!!!");
+            return false;
+        }
+    }
+
+    if (!manifest.rootDirectories.isEmpty()) {
+        qInfo() << i18nc("import/export config", "The file has a wrong format!!!");
         return false;
     }
 
-    auto rootDir = archive.directory();
     QTemporaryDir uniqueTempDir;
     QDir tempDir{uniqueTempDir.path()};
 
     qDebug() << "temp layout directory : " << tempDir.absolutePath();
 
-    if (rootDir) {
-        if (!tempDir.exists())
-            tempDir.mkpath(tempDir.absolutePath());
-
-        for(const auto &name : rootDir->entries()) {
-            auto fileEntry = rootDir->file(name);
-
-            if (fileEntry && (fileEntry->name() == QLatin1String("lattedockrc")
-                              || fileEntry->name() == QLatin1String("lattedock-appletsrc"))) {
-                if (!fileEntry->copyTo(tempDir.absolutePath())) {
-                    qInfo() << i18nc("import/export config", "The extracted file could not be copied!!!");
-                    archive.close();
-                    return false;
-                }
-            } else {
-                qInfo() << i18nc("import/export config", "The file has a wrong format!!!");
-                archive.close();
-                return false;
-            }
-        }
-    } else {
+    if (!uniqueTempDir.isValid()) {
         qInfo() << i18nc("import/export config", "The temp directory could not be created!!!");
-        archive.close();
+        return false;
+    }
+
+    if (!ArchiveInspector::extractRootFiles(oldConfigPath, manifest.rootFiles, tempDir.absolutePath())) {
+        qInfo() << i18nc("import/export config", "The extracted file could not be copied!!!");
         return false;
     }
 
@@ -440,62 +435,19 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
         return Importer::UnknownFileType;
     }
 
-    KTar archive(file, QStringLiteral("application/x-tar"));
-    archive.open(QIODevice::ReadOnly);
+    //! the archive is inspected without being extracted and its manifest
+    //! is reused when the same file is imported afterwards
+    ArchiveManifest manifest = ArchiveInspector::manifest(file);
 
     //! if the file isnt a tar archive
-    if (!archive.isOpen()) {
+    if (!manifest.isValid) {
         return Importer::UnknownFileType;
     }
 
-    QTemporaryDir archiveTempDir;
-
-    bool version1rc = false;
-    bool version1applets = false;
-
-    bool version2rc = false;
-    bool version2LatteDir = false;
-    bool version2layout = false;
-
-    archive.directory()->copyTo(archiveTempDir.path());
-
-
-    //rc file
-    QString rcFile(archiveTempDir.path() + "/lattedockrc");
-
-    if (QFile(rcFile).exists()) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(rcFile);
-        KConfigGroup universalGroup = KConfigGroup(lConfig, "UniversalSettings");
-        int version = universalGroup.readEntry("version", 1);
-
-        if (version == 1) {
-            version1rc = true;
-        } else if (version == 2) {
-            version2rc = true;
-        }
-    }
-
-    //applets file
-    QString appletsFile(archiveTempDir.path() + "/lattedock-appletsrc");
-
-    if (QFile(appletsFile).exists() && version1rc) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(appletsFile);
-        KConfigGroup generalGroup = KConfigGroup(lConfig, "LayoutSettings");
-        int version = generalGroup.readEntry("version", 1);
-
-        if (version == 1) {
-            version1applets = true;
-        } else if (version == 2) {
-            version2layout = true;
-        }
-    }
-
-    //latte directory
-    QString latteDir(archiveTempDir.path() + "/latte");
-
-    if (QDir(latteDir).exists()) {
-        version2LatteDir = true;
-    }
+    bool version1rc = (manifest.rcVersion == 1);
+    bool version2rc = (manifest.rcVersion == 2);
+    bool version1applets = version1rc && (manifest.appletsVersion == 1);
+    bool version2LatteDir = manifest.rootDirectories.contains(QLatin1String("latte"));
 
     if (version1applets) {
         return ConfigVersion1;
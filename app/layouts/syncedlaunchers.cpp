@@ -30,6 +30,9 @@ SyncedLaunchers::SyncedLaunchers(QObject *parent)
 
 SyncedLaunchers::~SyncedLaunchers()
 {
+    for (const auto &batch : m_batches) {
+        delete batch.autoCommitTimer;
+    }
 }
 
 void SyncedLaunchers::addAbilityClient(QQuickItem *client)
@@ -51,6 +54,9 @@ void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
 
     disconnect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
     m_clients.removeAll(client);
+
+    //! changes of a leaving sender are still delivered to the remaining clients
+    deliverBatch(client->property("clientId").toUInt());
 }
 
 void SyncedLaunchers::removeClientObject(QObject *obj)
@@ -110,104 +116,255 @@ QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName, uint senderId,
     return temclients;
 }
 
-void SyncedLaunchers::addLauncher(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher)
+void SyncedLaunchers::invokeLauncherAction(QQuickItem *client, const int &launcherGroup, const SyncedLauncherAction &action)
 {
-    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
-    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
+    auto *metaObject = client ? client->metaObject() : nullptr;
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncher(QVariant,QVariant)");
+    if (!metaObject) {
+        return;
+    }
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+    QString signature;
+
+    if (action.action == QLatin1String("add")) {
+        signature = "addSyncedLauncher(QVariant,QVariant)";
+    } else if (action.action == QLatin1String("remove")) {
+        signature = "removeSyncedLauncher(QVariant,QVariant)";
+    } else if (action.action == QLatin1String("addToActivity")) {
+        signature = "addSyncedLauncherToActivity(QVariant,QVariant,QVariant)";
+    } else if (action.action == QLatin1String("removeFromActivity")) {
+        signature = "removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)";
+    } else if (action.action == QLatin1String("drop")) {
+        signature = "dropSyncedUrls(QVariant,QVariant)";
+    } else {
+        return;
+    }
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
+    int methodIndex = metaObject->indexOfMethod(signature.toLatin1().constData());
+
+    if (methodIndex == -1) {
+        qDebug() << "Launchers Syncer Ability:" << signature << "was NOT found...";
+        return;
+    }
+
+    QMetaMethod method = metaObject->method(methodIndex);
+
+    if (action.action == QLatin1String("drop")) {
+        method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, QStringList(action.launcher)));
+    } else if (action.activity.isEmpty()) {
+        method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, action.launcher));
+    } else {
+        method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, action.launcher), Q_ARG(QVariant, action.activity));
+    }
+}
+
+void SyncedLaunchers::invokeLaunchersDiff(QQuickItem *client, const int &launcherGroup, const QList<SyncedLauncherAction> &actions)
+{
+    auto *metaObject = client ? client->metaObject() : nullptr;
+
+    if (!metaObject || actions.isEmpty()) {
+        return;
+    }
+
+    int methodIndex = metaObject->indexOfMethod("applySyncedLaunchersDiff(QVariant,QVariant)");
+
+    if (methodIndex == -1) {
+        //! older clients that do not support diffs receive the actions one by one
+        for (const auto &action : actions) {
+            invokeLauncherAction(client, launcherGroup, action);
         }
+        return;
     }
+
+    QVariantList diff;
+
+    for (const auto &action : actions) {
+        QVariantMap record;
+        record["action"] = action.action;
+        record["launcher"] = action.launcher;
+        record["activity"] = action.activity;
+        diff << record;
+    }
+
+    QMetaMethod method = metaObject->method(methodIndex);
+    method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, diff));
 }
 
-void SyncedLaunchers::removeLauncher(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher)
+void SyncedLaunchers::sendLaunchersDiff(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, const QList<SyncedLauncherAction> &actions)
 {
+    //! merge repeated identical requests for the same launcher, they are idempotent for the clients
+    QList<SyncedLauncherAction> diff;
+    QHash<QString, int> lastActionIndex;
+
+    for (const auto &action : actions) {
+        QString key = action.launcher + "\n" + action.activity;
+
+        if (lastActionIndex.contains(key) && diff[lastActionIndex[key]].action == action.action) {
+            continue;
+        }
+
+        lastActionIndex[key] = diff.count();
+        diff << action;
+    }
+
+    if (diff.isEmpty()) {
+        return;
+    }
+
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncher(QVariant,QVariant)");
+        invokeLaunchersDiff(c, launcherGroup, diff);
+    }
+}
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+void SyncedLaunchers::addLauncher(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher)
+{
+    if (queueInBatch(layoutName, senderId, launcherGroup, launcherGroupId, {"add", launcher, QString()})) {
+        return;
+    }
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
-        }
+    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
+    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
+
+    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
+        invokeLauncherAction(c, launcherGroup, {"add", launcher, QString()});
     }
 }
 
-void SyncedLaunchers::addLauncherToActivity(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher, QString activity)
+void SyncedLaunchers::removeLauncher(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher)
 {
+    if (queueInBatch(layoutName, senderId, launcherGroup, launcherGroupId, {"remove", launcher, QString()})) {
+        return;
+    }
+
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
+        invokeLauncherAction(c, launcherGroup, {"remove", launcher, QString()});
+    }
+}
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncherToActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
+void SyncedLaunchers::addLauncherToActivity(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher, QString activity)
+{
+    if (queueInBatch(layoutName, senderId, launcherGroup, launcherGroupId, {"addToActivity", launcher, activity})) {
+        return;
+    }
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
-        }
+    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
+    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
+
+    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
+        invokeLauncherAction(c, launcherGroup, {"addToActivity", launcher, activity});
     }
 }
 
 void SyncedLaunchers::removeLauncherFromActivity(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QString launcher, QString activity)
 {
+    if (queueInBatch(layoutName, senderId, launcherGroup, launcherGroupId, {"removeFromActivity", launcher, activity})) {
+        return;
+    }
+
     Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
     for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
+        invokeLauncherAction(c, launcherGroup, {"removeFromActivity", launcher, activity});
+    }
+}
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
+void SyncedLaunchers::urlsDropped(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QStringList urls)
+{
+    //! dropped urls are always delivered as one diff so that clients store their launchers only once
+    QList<SyncedLauncherAction> actions;
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
+    for (const auto &url : urls) {
+        actions << SyncedLauncherAction{"drop", url, QString()};
+    }
+
+    if (m_batches.contains(senderId)) {
+        bool queued{true};
+
+        for (const auto &action : actions) {
+            queued = queueInBatch(layoutName, senderId, launcherGroup, launcherGroupId, action) && queued;
+        }
+
+        if (queued) {
+            return;
         }
     }
+
+    sendLaunchersDiff(layoutName, senderId, launcherGroup, launcherGroupId, actions);
 }
 
-void SyncedLaunchers::urlsDropped(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QStringList urls)
+void SyncedLaunchers::beginBatch(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId)
 {
-    Types::LaunchersGroup group = static_cast<Types::LaunchersGroup>(launcherGroup);
-    QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
+    if (m_batches.contains(senderId)) {
+        m_batches[senderId].depth++;
+        return;
+    }
 
-    for(const auto c : clients(lName, senderId, group, launcherGroupId)) {
-        if (auto *metaObject = c->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("dropSyncedUrls(QVariant,QVariant)");
+    SyncedLaunchersBatch batch;
+    batch.layoutName = layoutName;
+    batch.launcherGroup = launcherGroup;
+    batch.launcherGroupId = launcherGroupId;
+    batch.depth = 1;
+
+    batch.autoCommitTimer = new QTimer();
+    batch.autoCommitTimer->setSingleShot(true);
+    batch.autoCommitTimer->setInterval(BATCHAUTOCOMMITINTERVAL);
+    connect(batch.autoCommitTimer, &QTimer::timeout, this, [this, senderId]() {
+        qDebug() << "Launchers Syncer Ability: batch of" << senderId << "was not committed in time, delivering it...";
+        deliverBatch(senderId);
+    });
+    batch.autoCommitTimer->start();
+
+    m_batches[senderId] = batch;
+}
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: dropSyncedUrls(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+void SyncedLaunchers::commitBatch(uint senderId)
+{
+    if (!m_batches.contains(senderId)) {
+        return;
+    }
 
-            QMetaMethod method = metaObject->method(methodIndex);
-            method.invoke(c, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
-        }
+    if (--m_batches[senderId].depth > 0) {
+        return;
+    }
+
+    deliverBatch(senderId);
+}
+
+bool SyncedLaunchers::queueInBatch(const QString &layoutName, const uint &senderId, const int &launcherGroup, const int &launcherGroupId, const SyncedLauncherAction &action)
+{
+    if (!m_batches.contains(senderId)) {
+        return false;
+    }
+
+    SyncedLaunchersBatch &batch = m_batches[senderId];
+
+    if (batch.layoutName != layoutName || batch.launcherGroup != launcherGroup || batch.launcherGroupId != launcherGroupId) {
+        //! sender changed its launchers group meanwhile, previous changes are delivered first
+        deliverBatch(senderId);
+        return false;
+    }
+
+    batch.actions << action;
+    return true;
+}
+
+void SyncedLaunchers::deliverBatch(const uint &senderId)
+{
+    if (!m_batches.contains(senderId)) {
+        return;
     }
+
+    SyncedLaunchersBatch batch = m_batches.take(senderId);
+    batch.autoCommitTimer->deleteLater();
+
+    sendLaunchersDiff(batch.layoutName, senderId, batch.launcherGroup, batch.launcherGroupId, batch.actions);
 }
 
 void SyncedLaunchers::validateLaunchersOrder(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QStringList launchers)
@@ -10,9 +10,12 @@
 #include <coretypes.h>
 
 // Qt
+#include <QHash>
 #include <QList>
 #include <QObject>
 #include <QQuickItem>
+#include <QTimer>
+#include <QVariant>
 
 namespace Plasma {
 class Applet;
@@ -27,6 +30,24 @@ class Manager;
 namespace Latte {
 namespace Layouts {
 
+struct SyncedLauncherAction
+{
+    QString action;
+    QString launcher;
+    QString activity;
+};
+
+//! launchers actions of a sender that are delivered together when its batch is committed
+struct SyncedLaunchersBatch
+{
+    QString layoutName;
+    int launcherGroup{0};
+    int launcherGroupId{-1};
+    int depth{0};
+    QList<SyncedLauncherAction> actions;
+    QTimer *autoCommitTimer{nullptr};
+};
+
 //! in order to support property the launcher groups Layout and Global
 //! the latte plasmoids must communicate between them with signals when
 //! there are changes in their models. This way we are trying to avoid
@@ -38,6 +59,9 @@ class SyncedLaunchers : public QObject
     Q_OBJECT
 
 public:
+    //! a batch that is never committed is delivered after this interval, so it can not stall syncing
+    static const int BATCHAUTOCOMMITINTERVAL = 1000;
+
     SyncedLaunchers(QObject *parent);
     ~SyncedLaunchers() override;
 
@@ -52,7 +76,21 @@ public slots:
     Q_INVOKABLE void urlsDropped(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QStringList urls);
     Q_INVOKABLE void validateLaunchersOrder(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, QStringList launchers);
 
+    //! bulk launchers changes of a sender between begin and commit are delivered to
+    //! the synced clients as one diff, batches can be nested
+    Q_INVOKABLE void beginBatch(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId);
+    Q_INVOKABLE void commitBatch(uint senderId);
+
 private:
+    bool queueInBatch(const QString &layoutName, const uint &senderId, const int &launcherGroup, const int &launcherGroupId, const SyncedLauncherAction &action);
+    void deliverBatch(const uint &senderId);
+
+    //! actions are merged and delivered to each client as one diff in order to be applied and stored once
+    void sendLaunchersDiff(QString layoutName, uint senderId, int launcherGroup, int launcherGroupId, const QList<SyncedLauncherAction> &actions);
+
+    void invokeLauncherAction(QQuickItem *client, const int &launcherGroup, const SyncedLauncherAction &action);
+    void invokeLaunchersDiff(QQuickItem *client, const int &launcherGroup, const QList<SyncedLauncherAction> &actions);
+
     QList<QQuickItem *> clients(QString layoutName, int groupId);
     QList<QQuickItem *> clients(QString layoutName, uint senderId, Latte::Types::LaunchersGroup launcherGroup, int launcherGroupId);
     QQuickItem *client(const int &id);
@@ -64,6 +102,8 @@ private:
     Layouts::Manager *m_manager{nullptr};
 
     QList<QQuickItem *> m_clients;
+
+    QHash<uint, SyncedLaunchersBatch> m_batches;
 };
 
 }
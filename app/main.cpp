@@ -11,6 +11,7 @@
 #include "lattecorona.h"
 #include "layouts/importer.h"
 #include "templates/templatesmanager.h"
+#include "tools/tracer.h"
 
 // C++
 #include <memory>
@@ -146,6 +147,16 @@ int main(int argc, char **argv)
     edgesOption.setFlags(QCommandLineOption::HiddenFromHelp);
     parser.addOption(edgesOption);
 
+    QCommandLineOption visibilityOption(QStringList() << QStringLiteral("visibility"));
+    visibilityOption.setDescription(QStringLiteral("Show messages for tracing views visibility transitions and their latencies (Only useful to devs)."));
+    visibilityOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOption(visibilityOption);
+
+    QCommandLineOption traceOption(QStringList() << QStringLiteral("trace"));
+    traceOption.setDescription(QStringLiteral("Record visibility, slide animations and windows tracking events together with show/hide latencies, they can be dumped through D-Bus traceEvents()/traceLatencies() (Only useful to devs)."));
+    traceOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOption(traceOption);
+
     QCommandLineOption localGeometryOption(QStringList() << QStringLiteral("localgeometry"));
     localGeometryOption.setDescription(QStringLiteral("Show visual window indicators for calculated local geometry."));
     localGeometryOption.setFlags(QCommandLineOption::HiddenFromHelp);
@@ -406,6 +417,16 @@ int main(int argc, char **argv)
         qInstallMessageHandler(noMessageOutput);
     }
 
+    //! tracing must be enabled before any view is created
+    if (parser.isSet(QStringLiteral("trace"))) {
+        Latte::Tracer::self()->setEnabled(true);
+    }
+
+    if (parser.isSet(QStringLiteral("debug")) && parser.isSet(QStringLiteral("visibility"))) {
+        Latte::Tracer::self()->setEnabled(true);
+        Latte::Tracer::self()->printToDebug(QStringLiteral("visibility"));
+        Latte::Tracer::self()->printToDebug(QStringLiteral("span"));
+    }
 
     auto signal_handler = [](int) {
         qGuiApp->exit();
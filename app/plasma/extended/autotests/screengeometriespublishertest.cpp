@@ -0,0 +1,254 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "screengeometriespublisher.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QTest>
+
+using namespace Latte::PlasmaExtended;
+
+//! timers are allowed to fire a bit late under load
+static const int TIMERTOLERANCE = 100;
+
+class ScreenGeometriesPublisherTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void defaults();
+    void firstPublishSendsAllScreens();
+    void unchangedGeometriesAreNotSent();
+    void onlyChangedGeometriesAreSent();
+    void clearedScreenIsSentOnce();
+    void removedScreenIsCleared();
+    void clearForgetsSentGeometries();
+    void burstIsCoalesced();
+    void latencyBudgetLimitsContinuousBurst();
+
+private:
+    ScreenAvailableGeometry screen(const QString &name, const QRect &availableRect) const;
+
+    //! every announced rect or region is one dbus call towards plasma
+    int dbusCalls() const;
+
+private:
+    ScreenGeometriesPublisher *m_publisher{nullptr};
+
+    QElapsedTimer m_clock;
+
+    QList<qint64> m_requestsAt;
+    QList<QPair<QString, QRect>> m_rects;
+    QList<QPair<QString, QRegion>> m_regions;
+    int m_finished{0};
+};
+
+ScreenAvailableGeometry ScreenGeometriesPublisherTest::screen(const QString &name, const QRect &availableRect) const
+{
+    ScreenAvailableGeometry geometries;
+    geometries.name = name;
+    geometries.geometry = QRect(0, 0, 1920, 1080);
+    geometries.availableRect = availableRect;
+    geometries.availableRegion = QRegion(availableRect);
+    return geometries;
+}
+
+int ScreenGeometriesPublisherTest::dbusCalls() const
+{
+    return m_rects.count() + m_regions.count();
+}
+
+void ScreenGeometriesPublisherTest::init()
+{
+    m_requestsAt.clear();
+    m_rects.clear();
+    m_regions.clear();
+    m_finished = 0;
+
+    m_publisher = new ScreenGeometriesPublisher(this);
+    m_clock.start();
+
+    connect(m_publisher, &ScreenGeometriesPublisher::publishRequested, this, [&]() {
+        m_requestsAt << m_clock.elapsed();
+    });
+
+    connect(m_publisher, &ScreenGeometriesPublisher::availableScreenRectChanged, this, [&](const QString &screenName, const QRect &rect) {
+        m_rects << qMakePair(screenName, rect);
+    });
+
+    connect(m_publisher, &ScreenGeometriesPublisher::availableScreenRegionChanged, this, [&](const QString &screenName, const QRegion &region) {
+        m_regions << qMakePair(screenName, region);
+    });
+
+    connect(m_publisher, &ScreenGeometriesPublisher::publishFinished, this, [&]() {
+        m_finished++;
+    });
+}
+
+void ScreenGeometriesPublisherTest::cleanup()
+{
+    delete m_publisher;
+    m_publisher = nullptr;
+}
+
+void ScreenGeometriesPublisherTest::defaults()
+{
+    QCOMPARE(m_publisher->publishInterval(), 1000);
+    QCOMPARE(m_publisher->latencyBudget(), 3000);
+    QVERIFY(!m_publisher->isPublishPending());
+}
+
+void ScreenGeometriesPublisherTest::firstPublishSendsAllScreens()
+{
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040)),
+                          screen("HDMI-1", QRect(0, 40, 1920, 1040))});
+
+    QCOMPARE(dbusCalls(), 4);
+    QCOMPARE(m_rects[0], qMakePair(QString("DP-1"), QRect(0, 0, 1920, 1040)));
+    QCOMPARE(m_rects[1], qMakePair(QString("HDMI-1"), QRect(0, 40, 1920, 1040)));
+    QCOMPARE(m_finished, 1);
+}
+
+void ScreenGeometriesPublisherTest::unchangedGeometriesAreNotSent()
+{
+    const QList<ScreenAvailableGeometry> screens{screen("DP-1", QRect(0, 0, 1920, 1040))};
+
+    m_publisher->publish(screens);
+    QCOMPARE(dbusCalls(), 2);
+
+    for (int i=0; i<10; ++i) {
+        m_publisher->publish(screens);
+    }
+
+    QCOMPARE(dbusCalls(), 2);
+    QCOMPARE(m_finished, 11);
+}
+
+void ScreenGeometriesPublisherTest::onlyChangedGeometriesAreSent()
+{
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040)),
+                          screen("HDMI-1", QRect(0, 40, 1920, 1040))});
+    m_rects.clear();
+    m_regions.clear();
+
+    //! only the region of HDMI-1 changed
+    ScreenAvailableGeometry hdmi = screen("HDMI-1", QRect(0, 40, 1920, 1040));
+    hdmi.availableRegion = QRegion(0, 40, 1920, 1040).subtracted(QRegion(800, 40, 320, 60));
+
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040)), hdmi});
+
+    QCOMPARE(dbusCalls(), 1);
+    QCOMPARE(m_regions[0], qMakePair(QString("HDMI-1"), hdmi.availableRegion));
+}
+
+void ScreenGeometriesPublisherTest::clearedScreenIsSentOnce()
+{
+    const QList<ScreenAvailableGeometry> cleared{screen("DP-1", QRect(0, 0, 1920, 1080))};
+
+    m_publisher->publish(cleared);
+    QCOMPARE(dbusCalls(), 2);
+    QVERIFY(m_rects[0].second.isNull());
+    QVERIFY(m_regions[0].second.isNull());
+
+    m_publisher->publish(cleared);
+    m_publisher->publish(cleared);
+    QCOMPARE(dbusCalls(), 2);
+
+    //! a screen that gets docks again is sent again
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040))});
+    QCOMPARE(dbusCalls(), 4);
+}
+
+void ScreenGeometriesPublisherTest::removedScreenIsCleared()
+{
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040)),
+                          screen("HDMI-1", QRect(0, 40, 1920, 1040))});
+    m_rects.clear();
+    m_regions.clear();
+
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040))});
+
+    QCOMPARE(dbusCalls(), 2);
+    QCOMPARE(m_rects[0], qMakePair(QString("HDMI-1"), QRect()));
+    QVERIFY(m_regions[0].second.isNull());
+
+    //! the removed screen is cleared only once
+    m_publisher->publish({screen("DP-1", QRect(0, 0, 1920, 1040))});
+    QCOMPARE(dbusCalls(), 2);
+}
+
+void ScreenGeometriesPublisherTest::clearForgetsSentGeometries()
+{
+    const QList<ScreenAvailableGeometry> screens{screen("DP-1", QRect(0, 0, 1920, 1040))};
+
+    m_publisher->publish(screens);
+    m_publisher->clear({"DP-1"});
+
+    QCOMPARE(dbusCalls(), 4);
+    QVERIFY(m_rects[1].second.isNull());
+    QCOMPARE(m_finished, 2);
+
+    //! plasma forgot the geometries, so they must be sent again
+    m_publisher->publish(screens);
+    QCOMPARE(dbusCalls(), 6);
+}
+
+void ScreenGeometriesPublisherTest::burstIsCoalesced()
+{
+    m_publisher->setPublishInterval(100);
+    m_publisher->setLatencyBudget(1000);
+
+    for (int i=0; i<20; ++i) {
+        m_publisher->schedulePublish();
+    }
+
+    QVERIFY(m_publisher->isPublishPending());
+    QCOMPARE(m_requestsAt.count(), 0);
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_requestsAt.count(), 1, m_publisher->publishInterval() + TIMERTOLERANCE);
+
+    QTest::qWait(m_publisher->publishInterval() + TIMERTOLERANCE);
+    QCOMPARE(m_requestsAt.count(), 1);
+    QVERIFY(!m_publisher->isPublishPending());
+}
+
+void ScreenGeometriesPublisherTest::latencyBudgetLimitsContinuousBurst()
+{
+    m_publisher->setPublishInterval(100);
+    m_publisher->setLatencyBudget(300);
+
+    QList<qint64> changesAt;
+
+    //! the publish interval never expires during the burst
+    while (m_clock.elapsed() < 1000) {
+        m_publisher->schedulePublish();
+        changesAt << m_clock.elapsed();
+        QTest::qWait(50);
+    }
+
+    QTRY_VERIFY_WITH_TIMEOUT(!m_publisher->isPublishPending(), m_publisher->latencyBudget() + TIMERTOLERANCE);
+
+    QVERIFY(m_requestsAt.count() >= 3);
+    QVERIFY(m_requestsAt.count() <= 5);
+
+    //! no change waited longer than the latency budget
+    for (const auto &changeAt : changesAt) {
+        for (const auto &requestAt : m_requestsAt) {
+            if (requestAt >= changeAt) {
+                QVERIFY(requestAt - changeAt <= m_publisher->latencyBudget() + TIMERTOLERANCE);
+                break;
+            }
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(ScreenGeometriesPublisherTest)
+
+#include "screengeometriespublishertest.moc"
@@ -22,8 +22,6 @@
 #define PLASMASERVICE "org.kde.plasmashell"
 #define PLASMASTRUTNAMESPACE "org.kde.PlasmaShell.StrutManager"
 
-#define PUBLISHINTERVAL 1000
-
 namespace Latte {
 namespace PlasmaExtended {
 
@@ -38,9 +36,10 @@ ScreenGeometries::ScreenGeometries(Latte::Corona *parent)
     m_startupInitTimer.setSingleShot(true);
     connect(&m_startupInitTimer, &QTimer::timeout, this, &ScreenGeometries::init);
 
-    m_publishTimer.setInterval(PUBLISHINTERVAL);
-    m_publishTimer.setSingleShot(true);
-    connect(&m_publishTimer, &QTimer::timeout, this, &ScreenGeometries::updateGeometries);
+    connect(&m_publisher, &ScreenGeometriesPublisher::publishRequested, this, &ScreenGeometries::updateGeometries);
+    connect(&m_publisher, &ScreenGeometriesPublisher::availableScreenRectChanged, this, &ScreenGeometries::setPlasmaAvailableScreenRect);
+    connect(&m_publisher, &ScreenGeometriesPublisher::availableScreenRegionChanged, this, &ScreenGeometries::setPlasmaAvailableScreenRegion);
+    connect(&m_publisher, &ScreenGeometriesPublisher::publishFinished, this, &ScreenGeometries::sendPendingMessages);
 
     m_startupInitTimer.start();
 
@@ -78,37 +77,24 @@ void ScreenGeometries::init()
         connect(m_corona, &Latte::Corona::availableScreenRectChangedFrom, this, &ScreenGeometries::availableScreenGeometryChangedFrom);
         connect(m_corona, &Latte::Corona::availableScreenRegionChangedFrom, this, &ScreenGeometries::availableScreenGeometryChangedFrom);
 
-        connect(m_corona->layoutsManager()->synchronizer(), &Latte::Layouts::Synchronizer::centralLayoutsChanged, this, [&]() {
-            m_publishTimer.start();
-        });
+        connect(m_corona->layoutsManager()->synchronizer(), &Latte::Layouts::Synchronizer::centralLayoutsChanged, &m_publisher, &ScreenGeometriesPublisher::schedulePublish);
 
         connect(m_corona->activitiesConsumer(), &KActivities::Consumer::currentActivityChanged, this, [&]() {
             if (m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma()) {
-                m_publishTimer.start();
+                m_publisher.schedulePublish();
             }
         });
 
         if (m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma()) {
-            m_publishTimer.start();
-        }
-    }
-}
-
-bool ScreenGeometries::screenIsActive(const QString &screenName) const
-{
-    for (QScreen *screen : qGuiApp->screens()) {
-        if (screen->name() == screenName) {
-            return true;
+            m_publisher.schedulePublish();
         }
     }
-
-    return false;
 }
 
 void ScreenGeometries::onBroadcastToPlasmaChanged()
 {
     if (m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma()) {
-        m_publishTimer.start();
+        m_publisher.schedulePublish();
     } else {
         clearGeometries();
     }
@@ -127,7 +113,9 @@ void ScreenGeometries::setPlasmaAvailableScreenRect(const QString &screenName, c
          << rect;
 
     message.setArguments(args);
-    QDBusConnection::sessionBus().call(message, QDBus::NoBlock);
+    m_pendingMessages << message;
+
+    qDebug() << " PLASMA SCREEN GEOMETRIES, AVAILABLE RECT :: " << screenName << " : " << rect;
 }
 
 void ScreenGeometries::setPlasmaAvailableScreenRegion(const QString &screenName, const QRegion &region)
@@ -157,7 +145,7 @@ void ScreenGeometries::setPlasmaAvailableScreenRegion(const QString &screenName,
          << regionvariant;
 
     message.setArguments(args);
-    QDBusConnection::sessionBus().call(message, QDBus::NoBlock);
+    m_pendingMessages << message;
 }
 
 void ScreenGeometries::clearGeometries()
@@ -166,33 +154,42 @@ void ScreenGeometries::clearGeometries()
         return;
     }
 
+    QStringList screenNames;
+
     for (QScreen *screen : qGuiApp->screens()) {
-        QString scrName = screen->name();
         int scrId = m_corona->screenPool()->id(screen->name());
 
         if (m_corona->screenPool()->hasScreenId(scrId)) {
-            setPlasmaAvailableScreenRect(scrName, QRect());
-            setPlasmaAvailableScreenRegion(scrName, QRegion());
+            screenNames << screen->name();
         }
     }
 
-    m_lastAvailableRect.clear();
-    m_lastAvailableRegion.clear();
+    m_publisher.clear(screenNames);
 }
 
-void ScreenGeometries::updateGeometries()
+void ScreenGeometries::sendPendingMessages()
 {
-    if (!m_plasmaInterfaceAvailable || !m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma()) {
+    if (m_pendingMessages.isEmpty()) {
         return;
     }
 
-    QStringList availableScreenNames;
+    qDebug() << " PLASMA SCREEN GEOMETRIES, SENDING MESSAGES :: " << m_pendingMessages.count();
+
+    for (const auto &message : m_pendingMessages) {
+        QDBusConnection::sessionBus().call(message, QDBus::NoBlock);
+    }
+
+    m_pendingMessages.clear();
+}
 
-    qDebug() << " PLASMA SCREEN GEOMETRIES, LAST AVAILABLE SCREEN RECTS :: " << m_lastAvailableRect;
+void ScreenGeometries::updateGeometries()
+{
+    if (!m_plasmaInterfaceAvailable || !m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma()) {
+        return;
+    }
 
-    QStringList clearedScreenNames;
+    QList<ScreenAvailableGeometry> screens;
 
-    //! check for available geometries changes
     for (QScreen *screen : qGuiApp->screens()) {
         QString scrName = screen->name();
         int scrId = m_corona->screenPool()->id(screen->name());
@@ -200,70 +197,34 @@ void ScreenGeometries::updateGeometries()
         qDebug() << " PLASMA SCREEN GEOMETRIES, SCREEN :: " << scrId << " - " << scrName;
 
         if (m_corona->screenPool()->hasScreenId(scrId)) {
-            QRect availableRect = m_corona->availableScreenRectWithCriteria(scrId,
-                                                                            QString(),
-                                                                            m_ignoreModes,
-                                                                            QList<Plasma::Types::Location>(),
-                                                                            true,
-                                                                            true);
-
-            QRegion availableRegion = m_corona->availableScreenRegionWithCriteria(scrId,
-                                                                                  QString(),
-                                                                                  m_ignoreModes,
-                                                                                  QList<Plasma::Types::Location>(),
-                                                                                  true,
-                                                                                  true);
-
-            bool clearedScreen = (availableRect == screen->geometry());
-
-            if (!clearedScreen) {
-                //! Disable checks because of the workaround concerning plasma desktop behavior
-                if (!m_lastAvailableRect.contains(scrName) || m_lastAvailableRect[scrName] != availableRect) {
-                    m_lastAvailableRect[scrName] = availableRect;
-                    setPlasmaAvailableScreenRect(scrName, availableRect);
-                    qDebug() << " PLASMA SCREEN GEOMETRIES, AVAILABLE RECT :: " << screen->name() << " : " << availableRect;
-                }
-
-                if (!m_lastAvailableRegion.contains(scrName) || m_lastAvailableRegion[scrName] != availableRegion) {
-                    m_lastAvailableRegion[scrName] = availableRegion;
-                    setPlasmaAvailableScreenRegion(scrName, availableRegion);
-                    qDebug() << " PLASMA SCREEN GEOMETRIES, AVAILABLE REGION :: " << screen->name() << " : " << availableRegion;
-                }
-            } else {
-                clearedScreenNames << scrName;
-            }
-        }
-
-        availableScreenNames << scrName;
-    }
-
-    //! check for inactive screens that were published previously
-    for (QString &lastScrName : m_lastScreenNames) {
-        bool scractive = screenIsActive(lastScrName);
-
-        if (!scractive || clearedScreenNames.contains(lastScrName)) {
-            //! screen became inactive and its geometries could be unpublished
-            setPlasmaAvailableScreenRect(lastScrName, QRect());
-            setPlasmaAvailableScreenRegion(lastScrName, QRegion());
-
-            m_lastAvailableRect.remove(lastScrName);
-            m_lastAvailableRegion.remove(lastScrName);
-        }
-
-        if (!scractive) {
-            qDebug() << " PLASMA SCREEN GEOMETRIES, INACTIVE SCREEN :: " << lastScrName;
-        } else if (clearedScreenNames.contains(lastScrName)) {
-            qDebug() << " PLASMA SCREEN GEOMETRIES, CLEARED SCREEN :: " << lastScrName;
+            ScreenAvailableGeometry geometries;
+            geometries.name = scrName;
+            geometries.geometry = screen->geometry();
+            geometries.availableRect = m_corona->availableScreenRectWithCriteria(scrId,
+                                                                                 QString(),
+                                                                                 m_ignoreModes,
+                                                                                 QList<Plasma::Types::Location>(),
+                                                                                 true,
+                                                                                 true);
+
+            geometries.availableRegion = m_corona->availableScreenRegionWithCriteria(scrId,
+                                                                                     QString(),
+                                                                                     m_ignoreModes,
+                                                                                     QList<Plasma::Types::Location>(),
+                                                                                     true,
+                                                                                     true);
+            screens << geometries;
         }
     }
 
-    m_lastScreenNames = availableScreenNames;
+    //! only screens whose geometries changed are sent and all of them together
+    m_publisher.publish(screens);
 }
 
 void ScreenGeometries::availableScreenGeometryChangedFrom(Latte::View *origin)
 {
     if (m_corona->universalSettings()->isAvailableGeometryBroadcastedToPlasma() &&  origin && origin->layout() && origin->layout()->isCurrent()) {
-        m_publishTimer.start();
+        m_publisher.schedulePublish();
     }
 }
 
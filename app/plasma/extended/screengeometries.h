@@ -8,10 +8,11 @@
 
 // local
 #include <coretypes.h>
+#include "screengeometriespublisher.h"
 
 // Qt
+#include <QDBusMessage>
 #include <QDBusServiceWatcher>
-#include <QHash>
 #include <QObject>
 #include <QTimer>
 
@@ -42,15 +43,16 @@ private slots:
     void onBroadcastToPlasmaChanged();
 
 private slots:
-    bool screenIsActive(const QString &screenName) const;
     void setPlasmaAvailableScreenRect(const QString &screenName, const QRect &rect);
     void setPlasmaAvailableScreenRegion(const QString &screenName, const QRegion &region);
+    void sendPendingMessages();
 
 private:
     bool m_plasmaInterfaceAvailable{false};
 
     //! this is needed in order to avoid too many costly calculations for available screen geometries
-    QTimer m_publishTimer;
+    //! and too many dbus calls towards plasma
+    ScreenGeometriesPublisher m_publisher;
 
     //! this is needed in order to check if Plasma>=5.18 is running
     QTimer m_startupInitTimer;
@@ -63,10 +65,8 @@ private:
         Latte::Types::SidebarAutoHide
     };
 
-    QStringList m_lastScreenNames;
-
-    QHash<QString, QRect> m_lastAvailableRect;
-    QHash<QString, QRegion> m_lastAvailableRegion;
+    //! messages of the current publish, they are sent together at its end
+    QList<QDBusMessage> m_pendingMessages;
 
     QDBusServiceWatcher *m_plasmaServiceWatcher{nullptr};
 };
@@ -0,0 +1,124 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "screengeometriespublisher.h"
+
+namespace Latte {
+namespace PlasmaExtended {
+
+ScreenGeometriesPublisher::ScreenGeometriesPublisher(QObject *parent)
+    : QObject(parent)
+{
+    m_publishTimer.setInterval(m_publishInterval);
+    m_publishTimer.setSingleShot(true);
+    connect(&m_publishTimer, &QTimer::timeout, this, &ScreenGeometriesPublisher::publishRequested);
+}
+
+int ScreenGeometriesPublisher::publishInterval() const
+{
+    return m_publishInterval;
+}
+
+void ScreenGeometriesPublisher::setPublishInterval(const int &interval)
+{
+    m_publishInterval = qMax(0, interval);
+    m_publishTimer.setInterval(m_publishInterval);
+}
+
+int ScreenGeometriesPublisher::latencyBudget() const
+{
+    return m_latencyBudget;
+}
+
+void ScreenGeometriesPublisher::setLatencyBudget(const int &budget)
+{
+    m_latencyBudget = qMax(0, budget);
+}
+
+bool ScreenGeometriesPublisher::isPublishPending() const
+{
+    return m_publishTimer.isActive();
+}
+
+void ScreenGeometriesPublisher::schedulePublish()
+{
+    if (!m_publishTimer.isActive()) {
+        m_publishPendingAge.start();
+    } else if (m_publishPendingAge.elapsed() >= (m_latencyBudget - m_publishInterval)) {
+        //! the pending publish must not be postponed any more
+        return;
+    }
+
+    m_publishTimer.start();
+}
+
+void ScreenGeometriesPublisher::clearScreen(const QString &screenName)
+{
+    emit availableScreenRectChanged(screenName, QRect());
+    emit availableScreenRegionChanged(screenName, QRegion());
+}
+
+void ScreenGeometriesPublisher::publish(const QList<ScreenAvailableGeometry> &screens)
+{
+    m_publishTimer.stop();
+
+    QStringList screenNames;
+
+    for (const auto &screen : screens) {
+        bool clearedScreen = (screen.availableRect == screen.geometry);
+
+        if (!clearedScreen) {
+            if (!m_lastAvailableRect.contains(screen.name) || m_lastAvailableRect[screen.name] != screen.availableRect) {
+                m_lastAvailableRect[screen.name] = screen.availableRect;
+                emit availableScreenRectChanged(screen.name, screen.availableRect);
+            }
+
+            if (!m_lastAvailableRegion.contains(screen.name) || m_lastAvailableRegion[screen.name] != screen.availableRegion) {
+                m_lastAvailableRegion[screen.name] = screen.availableRegion;
+                emit availableScreenRegionChanged(screen.name, screen.availableRegion);
+            }
+        } else if (!m_lastAvailableRect.contains(screen.name) || !m_lastAvailableRect[screen.name].isNull()) {
+            //! screen is cleared and plasma must be informed only once
+            clearScreen(screen.name);
+
+            m_lastAvailableRect[screen.name] = QRect();
+            m_lastAvailableRegion[screen.name] = QRegion();
+        }
+
+        screenNames << screen.name;
+    }
+
+    //! screens that were published previously but are not available any more
+    for (const auto &lastScreenName : m_lastScreenNames) {
+        if (!screenNames.contains(lastScreenName)) {
+            clearScreen(lastScreenName);
+
+            m_lastAvailableRect.remove(lastScreenName);
+            m_lastAvailableRegion.remove(lastScreenName);
+        }
+    }
+
+    m_lastScreenNames = screenNames;
+
+    emit publishFinished();
+}
+
+void ScreenGeometriesPublisher::clear(const QStringList &screenNames)
+{
+    m_publishTimer.stop();
+
+    for (const auto &screenName : screenNames) {
+        clearScreen(screenName);
+    }
+
+    m_lastScreenNames.clear();
+    m_lastAvailableRect.clear();
+    m_lastAvailableRegion.clear();
+
+    emit publishFinished();
+}
+
+}
+}
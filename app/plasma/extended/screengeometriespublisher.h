@@ -0,0 +1,90 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef PLASMASCREENGEOMETRIESPUBLISHER_H
+#define PLASMASCREENGEOMETRIESPUBLISHER_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QRect>
+#include <QRegion>
+#include <QStringList>
+#include <QTimer>
+
+namespace Latte {
+namespace PlasmaExtended {
+
+struct ScreenAvailableGeometry
+{
+    QString name;
+    QRect geometry;
+    QRect availableRect;
+    QRegion availableRegion;
+};
+
+//! Decides when and which available screen geometries are sent to plasma. Bursts of
+//! publish requests, e.g. during dock animations, are coalesced into one publish and
+//! continuous bursts are published at least once for every latency budget. Only the
+//! geometries that changed since they were last sent are announced
+class ScreenGeometriesPublisher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int PUBLISHINTERVAL = 1000;
+    static const int LATENCYBUDGET = 3000;
+
+    ScreenGeometriesPublisher(QObject *parent = nullptr);
+
+    int publishInterval() const;
+    void setPublishInterval(const int &interval);
+
+    int latencyBudget() const;
+    void setLatencyBudget(const int &budget);
+
+    bool isPublishPending() const;
+
+    //! screens that are not provided any more are cleared
+    void publish(const QList<ScreenAvailableGeometry> &screens);
+    //! screens are cleared and the last sent geometries are forgotten
+    void clear(const QStringList &screenNames);
+
+public slots:
+    void schedulePublish();
+
+signals:
+    //! pending publish can be computed and passed to publish()
+    void publishRequested();
+
+    void availableScreenRectChanged(const QString &screenName, const QRect &rect);
+    void availableScreenRegionChanged(const QString &screenName, const QRegion &region);
+    //! all changes of one publish have been announced and can be sent together
+    void publishFinished();
+
+private:
+    void clearScreen(const QString &screenName);
+
+private:
+    int m_publishInterval{PUBLISHINTERVAL};
+    int m_latencyBudget{LATENCYBUDGET};
+
+    QTimer m_publishTimer;
+    //! how long the oldest unpublished change has waited
+    QElapsedTimer m_publishPendingAge;
+
+    QStringList m_lastScreenNames;
+
+    //! last geometries sent per screen, cleared screens are stored
+    //! with null values in order to not send their clearing again
+    QHash<QString, QRect> m_lastAvailableRect;
+    QHash<QString, QRegion> m_lastAvailableRegion;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "randreventfilter.h"
+
+// local
+#include <config-latte.h>
+
+// X11
+#if HAVE_X11
+#include <xcb/xcb.h>
+#include <xcb/randr.h>
+#include <xcb/xcb_event.h>
+#endif
+
+namespace Latte {
+
+RandrEventFilter::RandrEventFilter(const int &randrEventBase, QObject *parent)
+    : QObject(parent),
+      m_randrEventBase(randrEventBase)
+{
+    m_burstTimer.setSingleShot(true);
+    m_burstTimer.setInterval(BURSTINTERVAL);
+    connect(&m_burstTimer, &QTimer::timeout, this, &RandrEventFilter::screensChanged);
+}
+
+int RandrEventFilter::randrEventBase() const
+{
+    return m_randrEventBase;
+}
+
+int RandrEventFilter::burstInterval() const
+{
+    return m_burstTimer.interval();
+}
+
+void RandrEventFilter::setBurstInterval(const int &interval)
+{
+    m_burstTimer.setInterval(qMax(0, interval));
+}
+
+bool RandrEventFilter::isBurstPending() const
+{
+    return m_burstTimer.isActive();
+}
+
+bool RandrEventFilter::nativeEventFilter(const QByteArray &eventType, void *message, long int *result)
+{
+    Q_UNUSED(result);
+#if HAVE_X11
+    if (m_randrEventBase < 0 || eventType != "xcb_generic_event_t") {
+        return false;
+    }
+
+    xcb_generic_event_t *ev = static_cast<xcb_generic_event_t *>(message);
+
+    if (XCB_EVENT_RESPONSE_TYPE(ev) == m_randrEventBase + XCB_RANDR_SCREEN_CHANGE_NOTIFY) {
+        //! screens reconfiguration is handled after its burst of events
+        m_burstTimer.start();
+    }
+#else
+    Q_UNUSED(eventType);
+    Q_UNUSED(message);
+#endif
+    return false;
+}
+
+}
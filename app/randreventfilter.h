@@ -0,0 +1,49 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef RANDREVENTFILTER_H
+#define RANDREVENTFILTER_H
+
+// Qt
+#include <QAbstractNativeEventFilter>
+#include <QObject>
+#include <QTimer>
+
+namespace Latte {
+
+//! Watches X11 RandR screen change notifications. The native events filter is called
+//! for every X11 event that reaches the application, so events are only compared with
+//! the RandR first event. Notifications arrive in bursts during screens reconfiguration
+//! and a burst is reported once, after no notification arrived for the burst interval
+class RandrEventFilter : public QObject, public QAbstractNativeEventFilter
+{
+    Q_OBJECT
+
+public:
+    static const int BURSTINTERVAL = 100;
+
+    RandrEventFilter(const int &randrEventBase, QObject *parent = nullptr);
+
+    int randrEventBase() const;
+
+    int burstInterval() const;
+    void setBurstInterval(const int &interval);
+
+    bool isBurstPending() const;
+
+    bool nativeEventFilter(const QByteArray &eventType, void *message, long *result) override;
+
+signals:
+    void screensChanged();
+
+private:
+    int m_randrEventBase{-1};
+
+    QTimer m_burstTimer;
+};
+
+}
+
+#endif
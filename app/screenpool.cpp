@@ -8,6 +8,7 @@
 
 // local
 #include <config-latte.h>
+#include "randreventfilter.h"
 
 // Qt
 #include <QDebug>
@@ -23,7 +24,6 @@
 #include <QtX11Extras/QX11Info>
 #include <xcb/xcb.h>
 #include <xcb/randr.h>
-#include <xcb/xcb_event.h>
 #endif
 
 namespace Latte {
@@ -34,7 +34,21 @@ ScreenPool::ScreenPool(KSharedConfig::Ptr config, QObject *parent)
     : QObject(parent),
       m_configGroup(KConfigGroup(config, QStringLiteral("ScreenConnectors")))
 {
-    qApp->installNativeEventFilter(this);
+#if HAVE_X11
+    if (QX11Info::isPlatformX11()) {
+        //! RandR first event is retrieved once and not for every X11 event
+        const xcb_query_extension_reply_t *reply = xcb_get_extension_data(QX11Info::connection(), &xcb_randr_id);
+
+        if (reply && reply->present) {
+            // a particular edge case: when we switch the only enabled screen
+            // we don't have any signal about it, the primary screen changes but we have the same old QScreen* getting recycled
+            // see https://bugs.kde.org/show_bug.cgi?id=373880
+            m_randrEventFilter = new RandrEventFilter(reply->first_event, this);
+            connect(m_randrEventFilter, &RandrEventFilter::screensChanged, this, &ScreenPool::updatePrimaryConnector);
+            qApp->installNativeEventFilter(m_randrEventFilter);
+        }
+    }
+#endif
 
     m_configSaveTimer.setSingleShot(true);
     connect(&m_configSaveTimer, &QTimer::timeout, this, [this]() {
@@ -292,39 +306,17 @@ QScreen *ScreenPool::screenForId(int id)
     return screen;
 }
 
-bool ScreenPool::nativeEventFilter(const QByteArray &eventType, void *message, long int *result)
+void ScreenPool::updatePrimaryConnector()
 {
-    Q_UNUSED(result);
-#if HAVE_X11
-
-    // a particular edge case: when we switch the only enabled screen
-    // we don't have any signal about it, the primary screen changes but we have the same old QScreen* getting recycled
-    // see https://bugs.kde.org/show_bug.cgi?id=373880
-    // if this slot will be invoked many times, their//second time on will do nothing as name and primaryconnector will be the same by then
-    if (eventType != "xcb_generic_event_t") {
-        return false;
-    }
-
-    xcb_generic_event_t *ev = static_cast<xcb_generic_event_t *>(message);
-
-    const auto responseType = XCB_EVENT_RESPONSE_TYPE(ev);
-
-    const xcb_query_extension_reply_t *reply = xcb_get_extension_data(QX11Info::connection(), &xcb_randr_id);
-
-    if (responseType == reply->first_event + XCB_RANDR_SCREEN_CHANGE_NOTIFY) {
-        if (qGuiApp->primaryScreen()->name() != m_lastPrimaryConnector) {
-            //new screen?
-            if (id(qGuiApp->primaryScreen()->name()) < 0) {
-                insertScreenMapping(qGuiApp->primaryScreen()->name());
-            }
-
-            m_lastPrimaryConnector = qGuiApp->primaryScreen()->name();
-            emit primaryPoolChanged();
+    if (qGuiApp->primaryScreen()->name() != m_lastPrimaryConnector) {
+        //new screen?
+        if (id(qGuiApp->primaryScreen()->name()) < 0) {
+            insertScreenMapping(qGuiApp->primaryScreen()->name());
         }
-    }
 
-#endif
-    return false;
+        m_lastPrimaryConnector = qGuiApp->primaryScreen()->name();
+        emit primaryPoolChanged();
+    }
 }
 
 }
@@ -16,15 +16,18 @@
 #include <QScreen>
 #include <QString>
 #include <QTimer>
-#include <QAbstractNativeEventFilter>
 
 // KDE
 #include <KConfigGroup>
 #include <KSharedConfig>
 
+namespace Latte {
+class RandrEventFilter;
+}
+
 namespace Latte {
 
-class ScreenPool : public QObject, public QAbstractNativeEventFilter
+class ScreenPool : public QObject
 {
     Q_OBJECT
 
@@ -58,11 +61,10 @@ signals:
     void screenGeometryChanged();
 
 protected:
-    bool nativeEventFilter(const QByteArray &eventType, void *message, long *result) Q_DECL_OVERRIDE;
-
     int firstAvailableId() const;
 
 private slots:
+    void updatePrimaryConnector();
     void updateScreenGeometry(const QScreen *screen);
     void onScreenAdded(const QScreen *screen);
     void onScreenRemoved(const QScreen *screen);
@@ -79,6 +81,8 @@ private:
     QString m_lastPrimaryConnector;
 
     QTimer m_configSaveTimer;
+
+    RandrEventFilter *m_randrEventFilter{nullptr};
 };
 
 }
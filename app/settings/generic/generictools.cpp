@@ -7,9 +7,19 @@
 
 // Qt
 #include <QApplication>
+#include <QCache>
+#include <QDateTime>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QHash>
+#include <QImageReader>
+#include <QPointer>
+#include <QSet>
 #include <QStyle>
 #include <QTextDocument>
+#include <QThreadPool>
+#include <QWidget>
 
 namespace Latte {
 
@@ -18,6 +28,141 @@ const int INDICATORCHANGESLENGTH = 6;
 const int INDICATORCHANGESMARGIN = 5;
 const int MARGIN = 2;
 
+namespace {
+
+//! how often the modification time of a background file is checked while painting
+const int BACKGROUNDSTATINTERVAL = 2000;
+//! thumbnails cache budget in KB
+const int BACKGROUNDTHUMBNAILSCOST = 4096;
+
+//! Decoded and scaled layout background thumbnails that are shared between all
+//! delegates and combo boxes. Files are decoded only once on a worker thread and
+//! until they are ready a placeholder is painted. Cache is accessed only from the
+//! GUI thread, workers post their results back through the application object.
+class BackgroundThumbnails
+{
+public:
+    static BackgroundThumbnails *self()
+    {
+        static BackgroundThumbnails s_thumbnails;
+        return &s_thumbnails;
+    }
+
+    QImage thumbnail(const QString &path, const QSize &size, qreal dpr, QPaintDevice *requester)
+    {
+        QString key = cacheKey(path, size, dpr);
+
+        if (QImage *cached = m_thumbnails.object(key)) {
+            return *cached;
+        }
+
+        if (requester && requester->devType() == QInternal::Widget) {
+            QPointer<QWidget> widget = static_cast<QWidget *>(requester);
+            if (!m_requesters[key].contains(widget)) {
+                m_requesters[key] << widget;
+            }
+        }
+
+        if (m_pending.contains(key)) {
+            return QImage();
+        }
+
+        m_pending << key;
+
+        QThreadPool::globalInstance()->start([key, path, size, dpr]() {
+            QImage thumb = BackgroundThumbnails::decode(path, size, dpr);
+
+            QMetaObject::invokeMethod(qApp, [key, thumb]() {
+                BackgroundThumbnails::self()->thumbnailReady(key, thumb);
+            }, Qt::QueuedConnection);
+        });
+
+        return QImage();
+    }
+
+private:
+    struct FileStamp
+    {
+        QDateTime lastModified;
+        QElapsedTimer checked;
+    };
+
+    BackgroundThumbnails()
+    {
+        m_thumbnails.setMaxCost(BACKGROUNDTHUMBNAILSCOST);
+    }
+
+    QString cacheKey(const QString &path, const QSize &size, qreal dpr)
+    {
+        FileStamp &stamp = m_stamps[path];
+
+        if (!stamp.checked.isValid() || stamp.checked.hasExpired(BACKGROUNDSTATINTERVAL)) {
+            stamp.lastModified = QFileInfo(path).lastModified();
+            stamp.checked.start();
+        }
+
+        return path + QLatin1Char('|') + QString::number(stamp.lastModified.toMSecsSinceEpoch())
+                + QLatin1Char('|') + QString::number(size.width()) + QLatin1Char('x') + QString::number(size.height())
+                + QLatin1Char('@') + QString::number(dpr);
+    }
+
+    void thumbnailReady(const QString &key, const QImage &thumb)
+    {
+        m_pending.remove(key);
+
+        //! failed files are cached as null images in order to not decode them again
+        m_thumbnails.insert(key, new QImage(thumb), qMax(1, static_cast<int>(thumb.sizeInBytes() / 1024)));
+
+        for (const auto &widget : m_requesters.take(key)) {
+            if (widget) {
+                widget->update();
+            }
+        }
+    }
+
+    //! runs on a worker thread
+    static QImage decode(const QString &path, const QSize &size, qreal dpr)
+    {
+        QImageReader reader(path);
+        QSize imageSize = reader.size();
+
+        //! backgrounds are painted at their natural scale, so when the file is
+        //! bigger than the thumbnail only its top-left part needs to be decoded
+        if (imageSize.width() >= size.width() && imageSize.height() >= size.height()) {
+            reader.setClipRect(QRect(QPoint(0, 0), size));
+        }
+
+        QImage image = reader.read();
+
+        if (image.isNull()) {
+            return QImage();
+        }
+
+        QImage thumb(size * dpr, QImage::Format_ARGB32_Premultiplied);
+        thumb.fill(Qt::transparent);
+
+        QPainter painter(&thumb);
+        painter.setRenderHint(QPainter::Antialiasing, true);
+        painter.scale(dpr, dpr);
+        painter.setPen(Qt::NoPen);
+        //! patterns smaller than the thumbnail are tiled
+        painter.setBrush(QBrush(image));
+        painter.drawEllipse(QRect(QPoint(0, 0), size));
+        painter.end();
+
+        thumb.setDevicePixelRatio(dpr);
+
+        return thumb;
+    }
+
+    QCache<QString, QImage> m_thumbnails;
+    QHash<QString, FileStamp> m_stamps;
+    QHash<QString, QList<QPointer<QWidget>>> m_requesters;
+    QSet<QString> m_pending;
+};
+
+}
+
 bool isEnabled(const QStyleOption &option)
 {
     if (option.state & QStyle::State_Enabled) {
@@ -263,16 +408,22 @@ void drawLayoutIcon(QPainter *painter, const QStyleOption &option, const bool &i
         int backImageMargin = 1; //most icon themes provide 1-2px. padding around icons //OLD CALCS: ICONMARGIN; //qMin(target.height()/4, ICONMARGIN+1);
         QRect backTarget(target.x() + backImageMargin, target.y() + backImageMargin, target.width() - 2*backImageMargin, target.height() - 2*backImageMargin);
 
-        QPixmap backImage(iconName);
-        backImage = backImage.copy(backTarget);
+        qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : qApp->devicePixelRatio();
+        QImage thumb = BackgroundThumbnails::self()->thumbnail(iconName, backTarget.size(), dpr, painter->device());
 
         QPalette::ColorRole textColorRole = selected ? QPalette::HighlightedText : QPalette::Text;
 
-        QBrush imageBrush(backImage);
         QPen pen; pen.setWidth(1);
         pen.setColor(option.palette.color(Latte::colorGroup(option), textColorRole));
 
-        painter->setBrush(imageBrush);
+        if (thumb.isNull()) {
+            //! placeholder until the background is decoded
+            painter->setBrush(option.palette.brush(Latte::colorGroup(option), QPalette::Mid));
+        } else {
+            painter->drawImage(backTarget, thumb);
+            painter->setBrush(Qt::NoBrush);
+        }
+
         painter->setPen(pen);
 
         painter->drawEllipse(backTarget);
@@ -0,0 +1,359 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "layoutsrowscache.h"
+
+// Qt
+#include <QAbstractItemModelTester>
+#include <QAbstractTableModel>
+#include <QTest>
+
+using namespace Latte;
+using namespace Latte::Settings::Model;
+
+//! Minimal layouts table model that adds, removes, renames and re-ids its rows the same way
+//! the settings layouts model does, so the rows cache is driven through real model changes
+class TestLayoutsModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Columns
+    {
+        IDCOLUMN = 0,
+        NAMECOLUMN
+    };
+
+    enum Roles
+    {
+        LAYOUTHASCHANGESROLE = Qt::UserRole + 1,
+        ISNEWLAYOUTROLE
+    };
+
+    TestLayoutsModel(QObject *parent = nullptr)
+        : QAbstractTableModel(parent)
+    {
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_layoutsTable.rowCount();
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : NAMECOLUMN + 1;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        const int row = index.row();
+
+        if (!m_layoutsTable.rowExists(row)) {
+            return QVariant{};
+        }
+
+        const LayoutsRowsCache::RowCache &cache = rowCache(row);
+
+        if (role == LAYOUTHASCHANGESROLE) {
+            return cache.hasChanges;
+        } else if (role == ISNEWLAYOUTROLE) {
+            return (cache.originalRow < 0);
+        } else if (role == Qt::DisplayRole) {
+            return index.column() == IDCOLUMN ? m_layoutsTable[row].id : m_layoutsTable[row].name;
+        }
+
+        return QVariant{};
+    }
+
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override
+    {
+        const int row = index.row();
+
+        if (!m_layoutsTable.rowExists(row) || role != Qt::EditRole) {
+            return false;
+        }
+
+        if (index.column() == IDCOLUMN) {
+            //! ids change when layouts are renamed and their files are moved
+            m_layoutsTable[row].id = value.toString();
+            m_rows.update(o_layoutsTable, m_layoutsTable);
+        } else {
+            m_layoutsTable[row].name = value.toString();
+            m_rows.invalidateRow(row);
+        }
+
+        emit dataChanged(index, index, {role});
+        return true;
+    }
+
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex()) override
+    {
+        if (parent.isValid() || count <= 0 || !m_layoutsTable.rowExists(row) || !m_layoutsTable.rowExists(row + count - 1)) {
+            return false;
+        }
+
+        beginRemoveRows(QModelIndex(), row, row + count - 1);
+        for (int i=0; i<count; ++i) {
+            m_layoutsTable.remove(row);
+        }
+        m_rows.update(o_layoutsTable, m_layoutsTable);
+        endRemoveRows();
+
+        return true;
+    }
+
+    void appendLayout(const Data::Layout &layout)
+    {
+        int newRow = m_layoutsTable.sortedPosForName(layout.name);
+
+        beginInsertRows(QModelIndex(), newRow, newRow);
+        m_layoutsTable.insert(newRow, layout);
+        m_rows.update(o_layoutsTable, m_layoutsTable);
+        endInsertRows();
+    }
+
+    void appendOriginalLayout(const Data::Layout &layout)
+    {
+        o_layoutsTable.insert(o_layoutsTable.sortedPosForName(layout.name), layout);
+        appendLayout(layout);
+    }
+
+    void applyData()
+    {
+        o_layoutsTable = m_layoutsTable;
+        m_rows.update(o_layoutsTable, m_layoutsTable);
+        emit dataChanged(index(0, IDCOLUMN), index(rowCount() - 1, NAMECOLUMN));
+    }
+
+    const Data::LayoutsTable &currentLayouts() const
+    {
+        return m_layoutsTable;
+    }
+
+    const Data::LayoutsTable &originalLayouts() const
+    {
+        return o_layoutsTable;
+    }
+
+    const LayoutsRowsCache &rows() const
+    {
+        return m_rows;
+    }
+
+    int iconCalculations() const
+    {
+        return m_iconCalculations;
+    }
+
+private:
+    const LayoutsRowsCache::RowCache &rowCache(const int &row) const
+    {
+        if (!m_rows.isValid(row)) {
+            m_iconCalculations++;
+            m_rows.validateRow(row, o_layoutsTable, m_layoutsTable, Data::LayoutIcon());
+        }
+
+        return m_rows.rowCache(row);
+    }
+
+private:
+    Data::LayoutsTable o_layoutsTable;
+    Data::LayoutsTable m_layoutsTable;
+
+    mutable int m_iconCalculations{0};
+    mutable LayoutsRowsCache m_rows;
+};
+
+class LayoutsRowsCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void insertedRowsAreIndexed();
+    void removedRowsAreUnindexed();
+    void renamedRowIsInvalidated();
+    void changedIdIsReindexed();
+    void appliedDataHasNoChanges();
+    void validRowsAreNotRecalculated();
+
+private:
+    Data::Layout layout(const QString &id, const QString &name) const;
+
+    //! indexes and cached values must always agree with the model tables
+    void verifyRows() const;
+
+private:
+    TestLayoutsModel *m_model{nullptr};
+    QAbstractItemModelTester *m_tester{nullptr};
+};
+
+Data::Layout LayoutsRowsCacheTest::layout(const QString &id, const QString &name) const
+{
+    Data::Layout layout;
+    layout.id = id;
+    layout.name = name;
+    return layout;
+}
+
+void LayoutsRowsCacheTest::verifyRows() const
+{
+    const Data::LayoutsTable &current = m_model->currentLayouts();
+    const Data::LayoutsTable &original = m_model->originalLayouts();
+
+    for (int i=0; i<current.rowCount(); ++i) {
+        QCOMPARE(m_model->rows().currentRow(current[i].id), i);
+
+        const int originalRow = original.indexOf(current[i].id);
+        QCOMPARE(m_model->rows().originalRow(current[i].id), originalRow);
+
+        const bool hasChanges = (originalRow < 0) || (original[originalRow] != current[i]);
+        QCOMPARE(m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE).toBool(), hasChanges);
+        QCOMPARE(m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::ISNEWLAYOUTROLE).toBool(), originalRow < 0);
+    }
+
+    for (int i=0; i<original.rowCount(); ++i) {
+        QCOMPARE(m_model->rows().originalRow(original[i].id), i);
+    }
+}
+
+void LayoutsRowsCacheTest::init()
+{
+    m_model = new TestLayoutsModel(this);
+    m_tester = new QAbstractItemModelTester(m_model, QAbstractItemModelTester::FailureReportingMode::QtTest, this);
+
+    m_model->appendOriginalLayout(layout("/layouts/Alpha.layout.latte", "Alpha"));
+    m_model->appendOriginalLayout(layout("/layouts/Gamma.layout.latte", "Gamma"));
+    m_model->appendOriginalLayout(layout("/layouts/Beta.layout.latte", "Beta"));
+}
+
+void LayoutsRowsCacheTest::cleanup()
+{
+    delete m_tester;
+    m_tester = nullptr;
+
+    delete m_model;
+    m_model = nullptr;
+}
+
+void LayoutsRowsCacheTest::insertedRowsAreIndexed()
+{
+    QCOMPARE(m_model->rowCount(), 3);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Beta.layout.latte"), 1);
+    verifyRows();
+
+    //! new layouts are inserted sorted by name and shift the rows after them
+    m_model->appendLayout(layout("/layouts/Aardvark.layout.latte", "Aardvark"));
+    m_model->appendLayout(layout("/layouts/Delta.layout.latte", "Delta"));
+
+    QCOMPARE(m_model->rowCount(), 5);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Aardvark.layout.latte"), 0);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Gamma.layout.latte"), 4);
+    QCOMPARE(m_model->rows().originalRow("/layouts/Delta.layout.latte"), -1);
+    verifyRows();
+}
+
+void LayoutsRowsCacheTest::removedRowsAreUnindexed()
+{
+    m_model->appendLayout(layout("/layouts/Delta.layout.latte", "Delta"));
+    verifyRows();
+
+    QVERIFY(m_model->removeRows(0, 2));
+
+    QCOMPARE(m_model->rowCount(), 2);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Alpha.layout.latte"), -1);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Beta.layout.latte"), -1);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Delta.layout.latte"), 0);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Gamma.layout.latte"), 1);
+
+    //! removed layouts are still part of the original data
+    QCOMPARE(m_model->rows().originalRow("/layouts/Alpha.layout.latte"), 0);
+    verifyRows();
+
+    QVERIFY(!m_model->removeRows(1, 2));
+    QVERIFY(m_model->removeRows(0, 2));
+    QCOMPARE(m_model->rowCount(), 0);
+    verifyRows();
+}
+
+void LayoutsRowsCacheTest::renamedRowIsInvalidated()
+{
+    const QModelIndex beta = m_model->index(1, TestLayoutsModel::NAMECOLUMN);
+    QVERIFY(!beta.data(TestLayoutsModel::LAYOUTHASCHANGESROLE).toBool());
+
+    QVERIFY(m_model->setData(beta, "Beta Renamed"));
+    QVERIFY(beta.data(TestLayoutsModel::LAYOUTHASCHANGESROLE).toBool());
+    verifyRows();
+
+    //! renaming back to the original name drops the changed state
+    QVERIFY(m_model->setData(beta, "Beta"));
+    QVERIFY(!beta.data(TestLayoutsModel::LAYOUTHASCHANGESROLE).toBool());
+    verifyRows();
+}
+
+void LayoutsRowsCacheTest::changedIdIsReindexed()
+{
+    const QModelIndex gammaId = m_model->index(2, TestLayoutsModel::IDCOLUMN);
+
+    QVERIFY(m_model->setData(gammaId, "/layouts/Omega.layout.latte"));
+
+    QCOMPARE(m_model->rows().currentRow("/layouts/Gamma.layout.latte"), -1);
+    QCOMPARE(m_model->rows().currentRow("/layouts/Omega.layout.latte"), 2);
+
+    //! the layout is not found in original data under its new id
+    QVERIFY(m_model->index(2, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::ISNEWLAYOUTROLE).toBool());
+    verifyRows();
+}
+
+void LayoutsRowsCacheTest::appliedDataHasNoChanges()
+{
+    m_model->appendLayout(layout("/layouts/Delta.layout.latte", "Delta"));
+    QVERIFY(m_model->setData(m_model->index(0, TestLayoutsModel::NAMECOLUMN), "Alpha Renamed"));
+    QVERIFY(m_model->removeRows(1, 1));
+    verifyRows();
+
+    m_model->applyData();
+
+    for (int i=0; i<m_model->rowCount(); ++i) {
+        QVERIFY(!m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE).toBool());
+        QVERIFY(!m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::ISNEWLAYOUTROLE).toBool());
+    }
+
+    verifyRows();
+}
+
+void LayoutsRowsCacheTest::validRowsAreNotRecalculated()
+{
+    //! first requests calculate every row once
+    for (int i=0; i<m_model->rowCount(); ++i) {
+        m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE);
+    }
+
+    const int calculations = m_model->iconCalculations();
+
+    for (int repeat=0; repeat<100; ++repeat) {
+        for (int i=0; i<m_model->rowCount(); ++i) {
+            m_model->index(i, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE);
+            m_model->index(i, TestLayoutsModel::IDCOLUMN).data(Qt::DisplayRole);
+        }
+    }
+
+    QCOMPARE(m_model->iconCalculations(), calculations);
+
+    //! only the renamed row is recalculated
+    QVERIFY(m_model->setData(m_model->index(1, TestLayoutsModel::NAMECOLUMN), "Beta Renamed"));
+    m_model->index(0, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE);
+    m_model->index(1, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE);
+    m_model->index(2, TestLayoutsModel::NAMECOLUMN).data(TestLayoutsModel::LAYOUTHASCHANGESROLE);
+    QCOMPARE(m_model->iconCalculations(), calculations + 1);
+}
+
+QTEST_GUILESS_MAIN(LayoutsRowsCacheTest)
+
+#include "layoutsrowscachetest.moc"
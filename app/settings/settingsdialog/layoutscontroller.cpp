@@ -19,6 +19,7 @@
 #include "../../screenpool.h"
 #include "../../data/uniqueidinfo.h"
 #include "../../layout/centrallayout.h"
+#include "../../layouts/archiveinspector.h"
 #include "../../layouts/importer.h"
 #include "../../layouts/manager.h"
 #include "../../layouts/synchronizer.h"
@@ -34,9 +35,6 @@
 #include <QTemporaryFile>
 
 // KDE
-#include <KArchive/KTar>
-#include <KArchive/KArchiveEntry>
-#include <KArchive/KArchiveDirectory>
 #include <KMessageWidget>
 
 namespace Latte {
@@ -847,19 +845,14 @@ void Layouts::duplicateSelectedLayout()
 
 bool Layouts::importLayoutsFromV1ConfigFile(QString file)
 {
-    KTar archive(file, QStringLiteral("application/x-tar"));
-    archive.open(QIODevice::ReadOnly);
+    Latte::Layouts::ArchiveManifest manifest = Latte::Layouts::ArchiveInspector::manifest(file);
 
     //! if the file isnt a tar archive
-    if (archive.isOpen()) {
+    if (manifest.isValid && manifest.rootFiles.contains(QStringLiteral("lattedock-appletsrc"))) {
         QDir tempDir{uniqueTempDirectory()};
 
-        const auto archiveRootDir = archive.directory();
-
-        for (const auto &name : archiveRootDir->entries()) {
-            auto fileEntry = archiveRootDir->file(name);
-            fileEntry->copyTo(tempDir.absolutePath());
-        }
+        //! only the applets file is needed in order to import the old layouts
+        Latte::Layouts::ArchiveInspector::extractRootFiles(file, {QStringLiteral("lattedock-appletsrc")}, tempDir.absolutePath());
 
         QString name = Latte::Layouts::Importer::nameOfConfigFile(file);
 
@@ -169,6 +169,7 @@ void Layouts::clear()
     if (m_layoutsTable.rowCount() > 0) {
         beginRemoveRows(QModelIndex(), 0, m_layoutsTable.rowCount() - 1);
         m_layoutsTable.clear();
+        updateRowIndexes();
         endRemoveRows();
     }
 }
@@ -179,6 +180,7 @@ void Layouts::appendLayout(const Latte::Data::Layout &layout)
 
     beginInsertRows(QModelIndex(), newRow, newRow);
     m_layoutsTable.insert(newRow, layout);
+    updateRowIndexes();
     endInsertRows();
 
     emit rowsInserted();
@@ -200,6 +202,7 @@ void Layouts::applyData()
 
     o_inMultipleMode = m_inMultipleMode;
     o_layoutsTable = m_layoutsTable;
+    updateRowIndexes();
 
     emit dataChanged(index(0, BACKGROUNDCOLUMN), index(rowCount()-1, ACTIVITYCOLUMN), roles);
 }
@@ -213,7 +216,7 @@ void Layouts::resetData()
 
 void Layouts::removeLayout(const QString &id)
 {
-    int index = m_layoutsTable.indexOf(id);
+    int index = rowForId(id);
 
     if (index >= 0) {
         removeRows(index,1);
@@ -222,9 +225,11 @@ void Layouts::removeLayout(const QString &id)
 
 void Layouts::setLayoutProperties(const Latte::Data::Layout &layout)
 {
-    if (m_layoutsTable.containsId(layout.id)) {
-        m_layoutsTable[layout.id] = layout;
-        int dataRow = m_layoutsTable.indexOf(layout.id);
+    int dataRow = rowForId(layout.id);
+
+    if (dataRow >= 0) {
+        m_layoutsTable[dataRow] = layout;
+        invalidateRow(dataRow);
 
         QVector<int> roles;
         roles << Qt::DisplayRole;
@@ -257,6 +262,7 @@ bool Layouts::removeRows(int row, int count, const QModelIndex &parent)
         for(int i=0; i<count; ++i) {
             m_layoutsTable.remove(firstRow);
         }
+        updateRowIndexes();
         endRemoveRows();
 
         return true;
@@ -278,26 +284,22 @@ QString Layouts::layoutNameForFreeActivities() const
 
 void Layouts::setCurrentLayoutForFreeActivities(const QString &id)
 {
-    if (m_layoutsTable.containsId(id)) {
+    if (m_rows.currentRow(id) >= 0) {
+        QVector<RowState> previous = rowStates();
         m_layoutsTable.setLayoutForFreeActivities(id);
-
-        QVector<int> roles;
-        roles << Qt::DisplayRole;
-        roles << Qt::UserRole;
-        emit dataChanged(index(0, ACTIVITYCOLUMN), index(rowCount()-1, ACTIVITYCOLUMN), roles);
+        emitRowChanges(previous);
     }
 }
 
 void Layouts::setOriginalLayoutForFreeActivities(const QString &id)
 {
-    if (o_layoutsTable.containsId(id)) {
+    if (m_rows.originalRow(id) >= 0) {
+        QVector<RowState> previous = rowStates();
         o_layoutsTable.setLayoutForFreeActivities(id);
         m_layoutsTable.setLayoutForFreeActivities(id);
-
-        QVector<int> roles;
-        roles << Qt::DisplayRole;
-        roles << Qt::UserRole;
-        emit dataChanged(index(0, ACTIVITYCOLUMN), index(rowCount()-1, ACTIVITYCOLUMN), roles);
+        //! original data changed too, so changed states must be recalculated for all rows
+        invalidateRows();
+        emitRowChanges(previous);
     }
 }
 
@@ -399,12 +401,113 @@ const Latte::Data::LayoutIcon Layouts::currentLayoutIcon(const QString &id) cons
     int row = rowForId(id);
 
     if (row >= 0) {
-        return icon(row);
+        return rowCache(row).icon;
     }
 
     return Latte::Data::LayoutIcon();
 }
 
+void Layouts::updateRowIndexes()
+{
+    m_rows.update(o_layoutsTable, m_layoutsTable);
+}
+
+void Layouts::invalidateRow(const int &row)
+{
+    m_rows.invalidateRow(row);
+}
+
+void Layouts::invalidateRows()
+{
+    m_rows.invalidateRows();
+}
+
+QVector<Layouts::RowState> Layouts::rowStates() const
+{
+    QVector<RowState> states;
+    states.reserve(m_layoutsTable.rowCount());
+
+    for (int i=0; i<m_layoutsTable.rowCount(); ++i) {
+        RowState state;
+        state.isActive = m_layoutsTable[i].isActive;
+        state.isConsideredActive = m_layoutsTable[i].isConsideredActive;
+        state.activities = m_layoutsTable[i].activities;
+        states << state;
+    }
+
+    return states;
+}
+
+void Layouts::emitRowChanges(const QVector<RowState> &previous)
+{
+    if (previous.count() != m_layoutsTable.rowCount()) {
+        //! rows were added or removed meanwhile, their notifications are already sent
+        return;
+    }
+
+    for (int i=0; i<m_layoutsTable.rowCount(); ++i) {
+        const Latte::Data::Layout &layout = m_layoutsTable[i];
+        QVector<int> nameRoles;
+        QVector<int> activitiesRoles;
+        QVector<int> sortingRoles;
+
+        if (previous[i].isActive != layout.isActive) {
+            nameRoles << ISACTIVEROLE;
+            activitiesRoles << ISACTIVEROLE;
+
+            if (m_inMultipleMode) {
+                //! active layouts are sorted first in every column
+                sortingRoles << SORTINGROLE;
+            }
+        }
+
+        if (previous[i].isConsideredActive != layout.isConsideredActive) {
+            nameRoles << ISCONSIDEREDACTIVEROLE;
+            if (!nameRoles.contains(SORTINGROLE)) {
+                nameRoles << SORTINGROLE;
+            }
+        }
+
+        if (previous[i].activities != layout.activities) {
+            nameRoles << LAYOUTHASCHANGESROLE;
+            activitiesRoles << Qt::DisplayRole << Qt::UserRole << ASSIGNEDACTIVITIESROLE << SORTINGROLE;
+        }
+
+        if (nameRoles.isEmpty() && activitiesRoles.isEmpty()) {
+            continue;
+        }
+
+        invalidateRow(i);
+
+        if (!sortingRoles.isEmpty()) {
+            if (!nameRoles.contains(SORTINGROLE)) {
+                nameRoles << SORTINGROLE;
+            }
+            if (!activitiesRoles.contains(SORTINGROLE)) {
+                activitiesRoles << SORTINGROLE;
+            }
+            emit dataChanged(index(i, MENUCOLUMN), index(i, BORDERSCOLUMN), sortingRoles);
+        }
+
+        if (!nameRoles.isEmpty()) {
+            emit dataChanged(index(i, NAMECOLUMN), index(i, NAMECOLUMN), nameRoles);
+        }
+
+        if (!activitiesRoles.isEmpty()) {
+            emit dataChanged(index(i, ACTIVITYCOLUMN), index(i, ACTIVITYCOLUMN), activitiesRoles);
+        }
+    }
+}
+
+const LayoutsRowsCache::RowCache &Layouts::rowCache(const int &row) const
+{
+    if (!m_rows.isValid(row)) {
+        m_rows.validateRow(row, o_layoutsTable, m_layoutsTable, icon(row));
+    }
+
+    return m_rows.rowCache(row);
+}
+
 QString Layouts::sortableText(const int &priority, const int &row) const
 {
     QString numberPart;
@@ -438,18 +541,16 @@ QVariant Layouts::data(const QModelIndex &index, int role) const
 {
     const int row = index.row();
     int column = index.column();
-    bool isNewLayout = !o_layoutsTable.containsId(m_layoutsTable[row].id);
 
     if (!m_layoutsTable.rowExists(row)) {
         return QVariant{};
     }
 
-    //! original data
-    Latte::Data::Layout original;
+    const LayoutsRowsCache::RowCache &cache = rowCache(row);
+    bool isNewLayout = (cache.originalRow < 0);
 
-    if (!isNewLayout) {
-        original = o_layoutsTable[m_layoutsTable[row].id];
-    }
+    //! original data
+    const Latte::Data::Layout &original = isNewLayout ? m_layoutsTable[row] : o_layoutsTable[cache.originalRow];
 
     if (role == IDROLE) {
         return m_layoutsTable[row].id;
@@ -481,11 +582,10 @@ QVariant Layouts::data(const QModelIndex &index, int role) const
     } else if (role == ISNEWLAYOUTROLE) {
         return isNewLayout;
     } else if (role == LAYOUTHASCHANGESROLE) {
-        return isNewLayout ? true : (original != m_layoutsTable[row]);
+        return cache.hasChanges;
     } else if (role == BACKGROUNDUSERROLE) {
-        Latte::Data::LayoutIcon _icon = icon(row);
         QVariant iconVariant;
-        iconVariant.setValue<Latte::Data::LayoutIcon>(_icon);
+        iconVariant.setValue<Latte::Data::LayoutIcon>(cache.icon);
         return iconVariant;
     } else if (role == ERRORSROLE) {
         return m_layoutsTable[row].errors;
@@ -509,9 +609,8 @@ QVariant Layouts::data(const QModelIndex &index, int role) const
         if (role == Qt::DisplayRole) {
             return m_layoutsTable[row].background;
         } else if (role == Qt::UserRole) {
-            Latte::Data::LayoutIcon _icon = icon(row);
             QVariant iconVariant;
-            iconVariant.setValue<Latte::Data::LayoutIcon>(_icon);
+            iconVariant.setValue<Latte::Data::LayoutIcon>(cache.icon);
             return iconVariant;
         }
         break;
@@ -607,18 +706,25 @@ QStringList Layouts::cleanStrings(const QStringList &original, const QStringList
 
 void Layouts::setOriginalActivitiesForLayout(const Latte::Data::Layout &layout)
 {
-    if (o_layoutsTable.containsId(layout.id) && m_layoutsTable.containsId(layout.id)) {
-        o_layoutsTable[layout.id].activities = layout.activities;
+    int orow = m_rows.originalRow(layout.id);
+    int mrow = rowForId(layout.id);
+
+    if (orow >= 0 && mrow >= 0) {
+        o_layoutsTable[orow].activities = layout.activities;
+        invalidateRow(mrow);
 
-        int mrow = rowForId(layout.id);
         setActivities(mrow, layout.activities);
     }
 }
 
 void Layouts::setOriginalViewsForLayout(const Latte::Data::Layout &layout)
 {
-    if (o_layoutsTable.containsId(layout.id) && m_layoutsTable.containsId(layout.id)) {
-        o_layoutsTable[layout.id].views = layout.views;
+    int orow = m_rows.originalRow(layout.id);
+    int mrow = rowForId(layout.id);
+
+    if (orow >= 0 && mrow >= 0) {
+        o_layoutsTable[orow].views = layout.views;
+        invalidateRow(mrow);
     }
 }
 
@@ -634,6 +740,7 @@ void Layouts::setActivities(const int &row, const QStringList &activities)
     roles << ASSIGNEDACTIVITIESROLE;
 
     m_layoutsTable[row].activities = activities;
+    invalidateRow(row);
     emit dataChanged(index(row, BACKGROUNDCOLUMN), index(row,ACTIVITYCOLUMN), roles);
 }
 
@@ -648,6 +755,7 @@ void Layouts::setId(const int &row, const QString &newId)
 
     QString oldId = m_layoutsTable[row].id;
     m_layoutsTable[row].id = newId;
+    updateRowIndexes();
     emit dataChanged(index(row, NAMECOLUMN), index(row,NAMECOLUMN), roles);
 }
 
@@ -666,6 +774,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
     //! common roles for all row cells
     if (role == ISLOCKEDROLE) {
         m_layoutsTable[row].isLocked = value.toBool();
+        invalidateRow(row);
         emit dataChanged(this->index(row,0), this->index(row, ACTIVITYCOLUMN), roles);
         return true;
     }
@@ -692,6 +801,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
                 m_layoutsTable[row].background = QString();
                 m_layoutsTable[row].color = back;
             }
+            invalidateRow(row);
             emit dataChanged(index, index, roles);
             return true;
         }
@@ -706,6 +816,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
                 return false;
             } else {
                 m_layoutsTable[row].name = value.toString();
+                invalidateRow(row);
                 emit dataChanged(index, index, roles);
                 return true;
             }
@@ -714,6 +825,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
     case MENUCOLUMN:
         if (role == Qt::UserRole) {
             m_layoutsTable[row].isShownInMenu = value.toBool();
+            invalidateRow(row);
             emit dataChanged(index, index, roles);
             emit dataChanged(this->index(row, NAMECOLUMN), this->index(row,NAMECOLUMN), roles);
             return true;
@@ -722,6 +834,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
     case BORDERSCOLUMN:
         if (role == Qt::UserRole) {
             m_layoutsTable[row].hasDisabledBorders = value.toBool();
+            invalidateRow(row);
             emit dataChanged(index, index, roles);
             emit dataChanged(this->index(row, NAMECOLUMN), this->index(row,NAMECOLUMN), roles);
             return true;
@@ -742,11 +855,7 @@ bool Layouts::setData(const QModelIndex &index, const QVariant &value, int role)
 
 void Layouts::updateActiveStates()
 {
-    QVector<int> roles;
-    roles << Qt::DisplayRole;
-    roles << Qt::UserRole;
-    roles << ISACTIVEROLE;
-    roles << SORTINGROLE;
+    QVector<RowState> previous = rowStates();
 
     for(int i=0; i<rowCount(); ++i) {
         bool iActive{false};
@@ -755,20 +864,15 @@ void Layouts::updateActiveStates()
             iActive = true;
         }
 
-        if (m_layoutsTable[i].isActive != iActive) {
-            m_layoutsTable[i].isActive = iActive;
-            emit dataChanged(index(i, BACKGROUNDCOLUMN), index(i,ACTIVITYCOLUMN), roles);
-        }
+        m_layoutsTable[i].isActive = iActive;
     }
+
+    emitRowChanges(previous);
 }
 
 void Layouts::updateConsideredActiveStates()
 {
-    QVector<int> roles;
-    roles << Qt::DisplayRole;
-    roles << Qt::UserRole;
-    roles << ISCONSIDEREDACTIVEROLE;
-    roles << SORTINGROLE;
+    QVector<RowState> previous = rowStates();
 
     if (!m_inMultipleMode) {
         //! single mode but not the running one
@@ -780,10 +884,7 @@ void Layouts::updateConsideredActiveStates()
                 iConsideredActive = true;
             }
 
-            if (m_layoutsTable[i].isConsideredActive != iConsideredActive) {
-                m_layoutsTable[i].isConsideredActive = iConsideredActive;
-                emit dataChanged(index(i, BACKGROUNDCOLUMN), index(i,ACTIVITYCOLUMN), roles);
-            }
+            m_layoutsTable[i].isConsideredActive = iConsideredActive;
         }
     } else if (m_inMultipleMode) {
         //! multiple mode but not the running one
@@ -804,17 +905,16 @@ void Layouts::updateConsideredActiveStates()
                 iConsideredActive = false;
             }
 
-            if (m_layoutsTable[i].isConsideredActive != iConsideredActive) {
-                m_layoutsTable[i].isConsideredActive = iConsideredActive;
-                emit dataChanged(index(i, BACKGROUNDCOLUMN), index(i,ACTIVITYCOLUMN), roles);
-            }
+            m_layoutsTable[i].isConsideredActive = iConsideredActive;
         }
     }
+
+    emitRowChanges(previous);
 }
 
 int Layouts::rowForId(const QString &id) const
 {
-    return m_layoutsTable.indexOf(id);
+    return m_rows.currentRow(id);
 }
 
 const Latte::Data::Layout &Layouts::at(const int &row)
@@ -824,8 +924,10 @@ const Latte::Data::Layout &Layouts::at(const int &row)
 
 const Latte::Data::Layout &Layouts::currentData(const QString &id)
 {
-    if (m_layoutsTable.containsId(id)){
-        return m_layoutsTable[id];
+    int row = rowForId(id);
+
+    if (row >= 0){
+        return m_layoutsTable[row];
     }
 
     return Latte::Data::Layout();
@@ -834,8 +936,10 @@ const Latte::Data::Layout &Layouts::currentData(const QString &id)
 
 const Latte::Data::Layout Layouts::originalData(const QString &id)
 {
-    if (o_layoutsTable.containsId(id)){
-        return o_layoutsTable[id];
+    int orow = m_rows.originalRow(id);
+
+    if (orow >= 0){
+        return o_layoutsTable[orow];
     }
 
     return Latte::Data::Layout();
@@ -869,6 +973,7 @@ void Layouts::setOriginalData(Latte::Data::LayoutsTable &data)
     beginInsertRows(QModelIndex(), 0, data.rowCount() - 1);
     o_layoutsTable = data;
     m_layoutsTable = data;
+    updateRowIndexes();
     endInsertRows();
 
     emit rowsInserted();
@@ -882,10 +987,7 @@ QList<Latte::Data::Layout> Layouts::alteredLayouts() const
     QList<Latte::Data::Layout> layouts;
 
     for(int i=0; i<rowCount(); ++i) {
-        QString currentId = m_layoutsTable[i].id;
-
-        if ((!o_layoutsTable.containsId(currentId))
-                || m_layoutsTable[currentId] != o_layoutsTable[currentId]) {
+        if (rowCache(i).hasChanges) {
             layouts << m_layoutsTable[i];
         }
     }
@@ -936,14 +1038,58 @@ void Layouts::initActivities()
 
 void Layouts::onActivitiesStatesChanged()
 {
+    //! find which activities changed since the last notification
+    bool activitiesListChanged = (m_notifiedActivitiesTable.rowCount() != m_activitiesTable.rowCount());
+    QStringList changedActivities;
+
+    for (int i=0; i<m_activitiesTable.rowCount(); ++i) {
+        const Latte::Data::Activity &activity = m_activitiesTable[i];
+
+        if (!m_notifiedActivitiesTable.containsId(activity.id)) {
+            activitiesListChanged = true;
+            break;
+        }
+
+        const Latte::Data::Activity &notified = m_notifiedActivitiesTable[activity.id];
+
+        if (notified.name != activity.name
+                || notified.icon != activity.icon
+                || notified.state != activity.state
+                || notified.isCurrent != activity.isCurrent) {
+            changedActivities << activity.id;
+        }
+    }
+
+    m_notifiedActivitiesTable = m_activitiesTable;
+
+    if (!activitiesListChanged && changedActivities.isEmpty()) {
+        return;
+    }
+
     QVector<int> roles;
-    roles << Qt::DisplayRole;
-    roles << Qt::UserRole;
     roles << ALLACTIVITIESDATAROLE;
-    roles << ALLACTIVITIESSORTEDROLE;
 
-    emit dataChanged(index(0, BACKGROUNDCOLUMN), index(rowCount()-1, BACKGROUNDCOLUMN), roles);
-    emit dataChanged(index(0, ACTIVITYCOLUMN), index(rowCount()-1, ACTIVITYCOLUMN), roles);
+    if (activitiesListChanged) {
+        roles << ALLACTIVITIESSORTEDROLE;
+    }
+
+    //! only activities cells that show the changed activities are repainted,
+    //! special activities depend on the real ones so their rows are always updated
+    for (int i=0; i<rowCount(); ++i) {
+        const QStringList &assigned = m_layoutsTable[i].activities;
+        bool affected = activitiesListChanged
+                || assigned.contains(Latte::Data::Layout::ALLACTIVITIESID)
+                || assigned.contains(Latte::Data::Layout::FREEACTIVITIESID)
+                || assigned.contains(Latte::Data::Layout::CURRENTACTIVITYID);
+
+        for (int j=0; !affected && j<changedActivities.count(); ++j) {
+            affected = assigned.contains(changedActivities[j]);
+        }
+
+        if (affected) {
+            emit dataChanged(index(i, ACTIVITYCOLUMN), index(i, ACTIVITYCOLUMN), roles);
+        }
+    }
 }
 
 void Layouts::onActivityAdded(const QString &id)
@@ -7,6 +7,7 @@
 #define SETTINGSLAYOUTSMODEL_H
 
 // local
+#include "layoutsrowscache.h"
 #include "../../lattecorona.h"
 #include "../../data/activitydata.h"
 #include "../../data/layoutdata.h"
@@ -15,7 +16,9 @@
 
 // Qt
 #include <QAbstractTableModel>
+#include <QHash>
 #include <QModelIndex>
+#include <QVector>
 
 
 namespace Latte {
@@ -164,8 +167,27 @@ private:
 
     Latte::Data::LayoutIcon icon(const int &row) const;
 
+    void updateRowIndexes();
+    void invalidateRow(const int &row);
+    void invalidateRows();
+
+    struct RowState
+    {
+        bool isActive{false};
+        bool isConsideredActive{false};
+        QStringList activities;
+    };
+
+    //! state snapshots that are compared in order to notify only the cells and roles that changed
+    QVector<RowState> rowStates() const;
+    void emitRowChanges(const QVector<RowState> &previous);
+
+    const LayoutsRowsCache::RowCache &rowCache(const int &row) const;
+
 private:
     Latte::Data::ActivitiesTable m_activitiesTable;
+    //! activities as they were when their changes were last notified
+    Latte::Data::ActivitiesTable m_notifiedActivitiesTable;
     QHash<QString, KActivities::Info *> m_activitiesInfo;
 
     //! original data
@@ -176,6 +198,8 @@ private:
     bool m_inMultipleMode{false};
     Latte::Data::LayoutsTable m_layoutsTable;
 
+    mutable LayoutsRowsCache m_rows;
+
     Latte::Corona *m_corona{nullptr};
 };
 
@@ -0,0 +1,82 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "layoutsrowscache.h"
+
+namespace Latte {
+namespace Settings {
+namespace Model {
+
+void LayoutsRowsCache::update(const Latte::Data::LayoutsTable &original, const Latte::Data::LayoutsTable &current)
+{
+    o_rowForId.clear();
+    m_rowForId.clear();
+
+    for (int i=0; i<original.rowCount(); ++i) {
+        o_rowForId[original[i].id] = i;
+    }
+
+    for (int i=0; i<current.rowCount(); ++i) {
+        m_rowForId[current[i].id] = i;
+    }
+
+    m_rowsCache = QVector<RowCache>(current.rowCount());
+}
+
+int LayoutsRowsCache::currentRow(const QString &id) const
+{
+    return m_rowForId.value(id, -1);
+}
+
+int LayoutsRowsCache::originalRow(const QString &id) const
+{
+    return o_rowForId.value(id, -1);
+}
+
+bool LayoutsRowsCache::isValid(const int &row) const
+{
+    return row >= 0 && row < m_rowsCache.count() && m_rowsCache[row].isValid;
+}
+
+void LayoutsRowsCache::invalidateRow(const int &row)
+{
+    if (row >= 0 && row < m_rowsCache.count()) {
+        m_rowsCache[row].isValid = false;
+    }
+}
+
+void LayoutsRowsCache::invalidateRows()
+{
+    for (auto &cache : m_rowsCache) {
+        cache.isValid = false;
+    }
+}
+
+const LayoutsRowsCache::RowCache &LayoutsRowsCache::rowCache(const int &row) const
+{
+    return m_rowsCache[row];
+}
+
+void LayoutsRowsCache::validateRow(const int &row,
+                                   const Latte::Data::LayoutsTable &original,
+                                   const Latte::Data::LayoutsTable &current,
+                                   const Latte::Data::LayoutIcon &icon)
+{
+    if (row < 0 || row >= m_rowsCache.count()) {
+        return;
+    }
+
+    RowCache &cache = m_rowsCache[row];
+    const Latte::Data::Layout &layout = current[row];
+
+    cache.originalRow = originalRow(layout.id);
+    cache.hasChanges = (cache.originalRow < 0) || (original[cache.originalRow] != layout);
+    cache.icon = icon;
+    cache.isValid = true;
+}
+
+}
+}
+}
@@ -0,0 +1,65 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef SETTINGSLAYOUTSROWSCACHE_H
+#define SETTINGSLAYOUTSROWSCACHE_H
+
+// local
+#include "../../data/layouticondata.h"
+#include "../../data/layoutstable.h"
+
+// Qt
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace Latte {
+namespace Settings {
+namespace Model {
+
+//! Id to row indexes for the original and current layouts of the layouts model and
+//! per-row caches of the values that are expensive for its data(). Indexes are rebuilt
+//! only when rows are added, removed or their ids change, cached values of a row are
+//! recalculated on their next request after the row is invalidated
+class LayoutsRowsCache
+{
+
+public:
+    struct RowCache
+    {
+        bool isValid{false};
+        //! row in original data, -1 for new layouts
+        int originalRow{-1};
+        bool hasChanges{false};
+        Latte::Data::LayoutIcon icon;
+    };
+
+    void update(const Latte::Data::LayoutsTable &original, const Latte::Data::LayoutsTable &current);
+
+    int currentRow(const QString &id) const;
+    int originalRow(const QString &id) const;
+
+    bool isValid(const int &row) const;
+    void invalidateRow(const int &row);
+    void invalidateRows();
+
+    const RowCache &rowCache(const int &row) const;
+    //! recalculates the cached values of the row, its icon is provided by the caller
+    void validateRow(const int &row,
+                     const Latte::Data::LayoutsTable &original,
+                     const Latte::Data::LayoutsTable &current,
+                     const Latte::Data::LayoutIcon &icon);
+
+private:
+    QHash<QString, int> o_rowForId;
+    QHash<QString, int> m_rowForId;
+    QVector<RowCache> m_rowsCache;
+};
+
+}
+}
+}
+
+#endif
@@ -25,6 +25,8 @@
 #include "../../view/view.h"
 
 // Qt
+#include <QApplication>
+#include <QFileInfo>
 #include <QHeaderView>
 #include <QItemSelection>
 
@@ -56,6 +58,10 @@ Views::Views(Settings::Handler::ViewsHandler *parent)
 
     connect(m_handler, &Handler::ViewsHandler::currentLayoutChanged, this, &Views::onCurrentLayoutChanged);
 
+    m_errorsWarningsTimer.setSingleShot(true);
+    m_errorsWarningsTimer.setInterval(0);
+    connect(&m_errorsWarningsTimer, &QTimer::timeout, this, &Views::validatePendingLayout);
+
     init();
 }
 
@@ -403,6 +409,7 @@ void Views::onCurrentLayoutChanged()
     if (currentlayout && currentlayout->isActive()) {
         m_currentLayoutConnections << connect(currentlayout, &Layout::GenericLayout::viewsCountChanged, this, [&, currentlayout](){
             m_model->updateActiveStatesBasedOn(currentlayout);
+            invalidateErrorsWarnings(currentlayout->file());
         });
     }
 
@@ -492,13 +499,78 @@ void Views::messagesForErrorsWarnings(const Latte::CentralLayout *centralLayout,
         return;
     }
 
-    Data::Layout currentdata = centralLayout->data();
+    QString layoutid = centralLayout->file();
 
     m_model->clearErrorsAndWarnings();
 
+    if (hasValidErrorsWarnings(centralLayout)) {
+        showErrorsWarnings(layoutid, m_errorsWarnings[layoutid], showNoErrorsMessage);
+        return;
+    }
+
+    //! validation runs after the dialog has been updated for the newly selected layout,
+    //! fast switching between layouts validates only the last one
+    m_pendingErrorsWarningsLayoutId = layoutid;
+    m_pendingShowNoErrorsMessage = showNoErrorsMessage;
+    m_errorsWarningsTimer.start();
+}
+
+bool Views::hasValidErrorsWarnings(const Latte::CentralLayout *centralLayout) const
+{
+    if (centralLayout->isActive() || !m_errorsWarnings.contains(centralLayout->file())) {
+        return false;
+    }
+
+    const ErrorsWarningsValidation &validation = m_errorsWarnings[centralLayout->file()];
+    QFileInfo fileinfo(centralLayout->file());
+
+    return validation.size == fileinfo.size()
+            && validation.lastModified == fileinfo.lastModified();
+}
+
+void Views::invalidateErrorsWarnings(const QString &layoutId)
+{
+    m_errorsWarnings.remove(layoutId);
+}
+
+void Views::validatePendingLayout()
+{
+    QString layoutid = m_pendingErrorsWarningsLayoutId;
+    m_pendingErrorsWarningsLayoutId.clear();
+
+    if (layoutid.isEmpty() || layoutid != m_handler->currentData().id) {
+        //! user moved to another layout meanwhile
+        return;
+    }
+
+    Latte::CentralLayout *centrallayout = m_handler->layoutsController()->centralLayout(layoutid);
+
+    if (!centrallayout) {
+        return;
+    }
+
+    QFileInfo fileinfo(centrallayout->file());
+
+    ErrorsWarningsValidation validation;
+    validation.size = fileinfo.size();
+    validation.lastModified = fileinfo.lastModified();
+    validation.errors = centrallayout->errors();
+    validation.warnings = centrallayout->warnings();
+
+    if (centrallayout->isActive()) {
+        m_errorsWarnings.remove(layoutid);
+    } else {
+        m_errorsWarnings[layoutid] = validation;
+    }
+
+    showErrorsWarnings(layoutid, validation, m_pendingShowNoErrorsMessage);
+}
+
+void Views::showErrorsWarnings(const QString &layoutId, const ErrorsWarningsValidation &validation, const bool &showNoErrorsMessage)
+{
     //! warnings
-    if (currentdata.warnings > 0) {
-        Data::WarningsList warnings = centralLayout->warnings();
+    if (validation.warnings.count() > 0) {
+        const Data::WarningsList &warnings = validation.warnings;
 
         // show warnings
         for (int i=0; i< warnings.count(); ++i) {
@@ -533,8 +605,8 @@ void Views::messagesForErrorsWarnings(const Latte::CentralLayout *centralLayout,
     }
 
     //! errors
-    if (currentdata.errors > 0) {
-        Data::ErrorsList errors = centralLayout->errors();
+    if (validation.errors.count() > 0) {
+        const Data::ErrorsList &errors = validation.errors;
 
         // show errors
         for (int i=0; i< errors.count(); ++i) {
@@ -568,9 +640,9 @@ void Views::messagesForErrorsWarnings(const Latte::CentralLayout *centralLayout,
         }
     }
 
-    m_handler->layoutsController()->setLayoutCurrentErrorsWarnings(currentdata.id, currentdata.errors, currentdata.warnings);
+    m_handler->layoutsController()->setLayoutCurrentErrorsWarnings(layoutId, validation.errors.count(), validation.warnings.count());
 
-    if (showNoErrorsMessage && currentdata.errors == 0 && currentdata.warnings == 0) {
+    if (showNoErrorsMessage && validation.errors.isEmpty() && validation.warnings.isEmpty()) {
         m_handler->showInlineMessage(i18n("Really nice! You are good to go, your layout does not report any errors or warnings."),
                                      KMessageWidget::Positive,
                                      false);
@@ -635,6 +707,7 @@ void Views::showDefaultInlineMessageValidator()
             lFile->reparseConfiguration();
         }
 
+        invalidateErrorsWarnings(currentlayout.id);
         messagesForErrorsWarnings(centrallayout, true);
     });
 
@@ -844,6 +917,7 @@ void Views::messageForWarningOrphanedSubContainments(const Data::Warning &warnin
             centrallayout->removeOrphanedSubContainment(orphaned[i]);
         }
 
+        invalidateErrorsWarnings(currentlayout.id);
         messagesForErrorsWarnings(centrallayout, true);
     });
 
@@ -853,86 +927,172 @@ void Views::messageForWarningOrphanedSubContainments(const Data::Warning &warnin
                                                    extraactions);
 }
 
-void Views::save()
+bool Views::prepareSaveTransaction(SaveTransaction &transaction)
 {
-    //! when this function is called we consider that removal has already been approved
-    updateDoubledMoveDestinationRows();
-
-    Latte::Data::Layout originallayout = m_handler->originalData();
     Latte::Data::Layout currentlayout = m_handler->currentData();
-    Latte::CentralLayout *central = m_handler->layoutsController()->centralLayout(currentlayout.id);
+    transaction.central = m_handler->layoutsController()->centralLayout(currentlayout.id);
+
+    if (!transaction.central) {
+        transaction.error = i18n("Layout <b>%1</b> can not be found.", currentlayout.name);
+        return false;
+    }
 
-    //! views in model
     Latte::Data::ViewsTable originalViews = m_model->originalViewsData();
     Latte::Data::ViewsTable currentViews = m_model->currentViewsData();
-    Latte::Data::ViewsTable alteredViews = m_model->alteredViews();
     Latte::Data::ViewsTable newViews = m_model->newViews();
 
-    QHash<QString, Data::View> newviewsresponses;
-    QHash<QString, Data::View> cuttedpastedviews;
-    QHash<QString, Data::View> cuttedpastedactiveviews;
-
-    m_debugSaveCall++;
-    qDebug() << "org.kde.latte ViewsDialog::save() call: " << m_debugSaveCall << "-------- ";
+    transaction.hasNewViews = (newViews.rowCount() > 0);
+    transaction.alteredViews = m_model->alteredViews();
+    transaction.removedViews = originalViews.subtracted(currentViews);
 
-    //! add new views that are accepted
     for(int i=0; i<newViews.rowCount(); ++i){
         if (newViews[i].isMoveDestination) {
             CentralLayout *originActive = originLayout(newViews[i]);
-            bool inmovebetweenactivelayouts = central->isActive() && originActive && central != originActive && hasValidOriginView(newViews[i]);
+            bool inmovebetweenactivelayouts = transaction.central->isActive() && originActive && transaction.central != originActive && hasValidOriginView(newViews[i]);
 
             if (inmovebetweenactivelayouts) {
-                cuttedpastedactiveviews[newViews[i].id] = newViews[i];
+                transaction.cuttedPastedActiveViews[newViews[i].id] = newViews[i];
                 continue;
             }
 
-            cuttedpastedviews[newViews[i].id] = newViews[i];
+            transaction.cuttedPastedViews[newViews[i].id] = newViews[i];
+        }
+
+        if (newViews[i].state() == Data::View::OriginFromViewTemplate || newViews[i].state() == Data::View::OriginFromLayout) {
+            if (!QFileInfo(newViews[i].originFile()).isReadable()) {
+                transaction.error = i18n("<b>%1</b> can not be added because its source file is not accessible.", newViews[i].name);
+                return false;
+            }
+
+            transaction.newViews << newViews[i];
+        }
+    }
+
+    for(const auto vid: transaction.cuttedPastedViews.keys()){
+        if (!hasValidOriginView(transaction.cuttedPastedViews[vid])) {
+            //! origin views that have not been created already are ignored
+            continue;
         }
 
-        if (newViews[i].state() == Data::View::OriginFromViewTemplate) {
-            Data::View addedview = central->newView(newViews[i]);
+        QString origincurrentid = transaction.cuttedPastedViews[vid].originLayout();
+        Data::Layout originlayout = m_handler->layoutsController()->originalData(origincurrentid);
 
-            newviewsresponses[newViews[i].id] = addedview;
-        } else if (newViews[i].state() == Data::View::OriginFromLayout) {
-            Data::View adjustedview = newViews[i];
-            adjustedview.setState(Data::View::OriginFromViewTemplate, newViews[i].originFile(), QString(), QString());
-            Data::View addedview = central->newView(adjustedview);
+        if (!m_handler->layoutsController()->centralLayout(originlayout.id)) {
+            transaction.error = i18n("<b>%1</b> can not be moved because layout <b>%2</b> can not be found.", transaction.cuttedPastedViews[vid].name, originlayout.name);
+            return false;
+        }
+    }
 
-            newviewsresponses[newViews[i].id] = addedview;
+    transaction.steps = transaction.newViews.rowCount()
+            + transaction.alteredViews.rowCount()
+            + transaction.removedViews.rowCount()
+            + transaction.cuttedPastedViews.count()
+            + transaction.cuttedPastedActiveViews.count();
+
+    return true;
+}
+
+void Views::reportSaveProgress(SaveTransaction &transaction, const QString &step, const Data::View &view)
+{
+    transaction.step++;
+    qDebug() << "org.kde.latte ViewsDialog::save() [" << transaction.step << "/" << transaction.steps << "]" << step << ":: " << view;
+}
+
+void Views::rollbackSaveTransaction(SaveTransaction &transaction)
+{
+    //! only newly created views can be reverted, all destructive steps run after them
+    for (int i=transaction.createdViews.rowCount()-1; i>=0; --i) {
+        qDebug() << "org.kde.latte ViewsDialog::save() rolling back created view :: " << transaction.createdViews[i];
+        transaction.central->removeView(transaction.createdViews[i]);
+    }
+
+    if (transaction.createdViews.rowCount() > 0) {
+        m_handler->corona()->layoutsManager()->synchronizer()->syncActiveLayoutsToOriginalFiles();
+    }
+
+    transaction.createdViews.clear();
+    transaction.newViewsResponses.clear();
+}
+
+bool Views::save()
+{
+    //! when this function is called we consider that removal has already been approved
+    updateDoubledMoveDestinationRows();
+
+    m_debugSaveCall++;
+    qDebug() << "org.kde.latte ViewsDialog::save() call: " << m_debugSaveCall << "-------- ";
+
+    //! the full change set is computed and validated before anything is applied
+    SaveTransaction transaction;
+
+    if (!prepareSaveTransaction(transaction)) {
+        m_handler->showInlineMessage(i18nc("settings:views save failed", "Changes can not be applied. %1", transaction.error),
+                                     KMessageWidget::Error,
+                                     true);
+        return false;
+    }
+
+    Latte::Data::Layout originallayout = m_handler->originalData();
+    Latte::CentralLayout *central = transaction.central;
+
+    //! containment changes are applied in one batch without repainting the table in between
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    m_view->setUpdatesEnabled(false);
+
+    //! add new views that are accepted, this is the only step that can fail
+    for(int i=0; i<transaction.newViews.rowCount(); ++i){
+        Data::View nextview = transaction.newViews[i];
+
+        if (nextview.state() == Data::View::OriginFromLayout) {
+            nextview.setState(Data::View::OriginFromViewTemplate, transaction.newViews[i].originFile(), QString(), QString());
+        }
+
+        reportSaveProgress(transaction, "adding view", nextview);
+        Data::View addedview = central->newView(nextview);
+
+        if (!addedview.isValid()) {
+            rollbackSaveTransaction(transaction);
+
+            m_view->setUpdatesEnabled(true);
+            QApplication::restoreOverrideCursor();
+
+            m_handler->showInlineMessage(i18nc("settings:views save failed", "Changes can not be applied. <b>%1</b> could not be created.", nextview.name),
+                                         KMessageWidget::Error,
+                                         true);
+            return false;
         }
+
+        transaction.createdViews << addedview;
+        transaction.newViewsResponses[transaction.newViews[i].id] = addedview;
     }
 
     //! update altered views
-    for (int i=0; i<alteredViews.rowCount(); ++i) {
-        if (alteredViews[i].state() == Data::View::IsCreated && !alteredViews[i].isMoveOrigin) {
-            qDebug() << "org.kde.latte ViewsDialog::save() updating altered view :: " << alteredViews[i];
-            central->updateView(alteredViews[i]);
+    for (int i=0; i<transaction.alteredViews.rowCount(); ++i) {
+        if (transaction.alteredViews[i].state() == Data::View::IsCreated && !transaction.alteredViews[i].isMoveOrigin) {
+            reportSaveProgress(transaction, "updating altered view", transaction.alteredViews[i]);
+            central->updateView(transaction.alteredViews[i]);
         }
     }
 
     //! remove deprecated views that have been removed from user
-    Latte::Data::ViewsTable removedViews = originalViews.subtracted(currentViews);
-
-    for (int i=0; i<removedViews.rowCount(); ++i) {
-        qDebug() << "org.kde.latte ViewsDialog::save() real removing view :: " << removedViews[i];
-        central->removeView(removedViews[i]);
+    for (int i=0; i<transaction.removedViews.rowCount(); ++i) {
+        reportSaveProgress(transaction, "real removing view", transaction.removedViews[i]);
+        central->removeView(transaction.removedViews[i]);
     }
 
     //! remove deprecated views from external layouts that must be removed because of Cut->Paste Action
-    for(const auto vid: cuttedpastedviews.keys()){
-        bool viewidisinteger{true};
-        int vid_int = cuttedpastedviews[vid].originView().toInt(&viewidisinteger);
-        QString vid_str = cuttedpastedviews[vid].originView();
-
-        if (vid_str.isEmpty() || !viewidisinteger || vid_int<=0) {
+    for(const auto vid: transaction.cuttedPastedViews.keys()){
+        if (!hasValidOriginView(transaction.cuttedPastedViews[vid])) {
             //! ignore origin views that have not been created already
             continue;
         }
 
-        qDebug() << "org.kde.latte ViewsDialog::save() removing cut-pasted view :: " << cuttedpastedviews[vid];
+        QString vid_str = transaction.cuttedPastedViews[vid].originView();
+
+        reportSaveProgress(transaction, "removing cut-pasted view", transaction.cuttedPastedViews[vid]);
 
         //! Be Careful: Remove deprecated views from Cut->Paste Action
-        QString origincurrentid = cuttedpastedviews[vid].originLayout();
+        QString origincurrentid = transaction.cuttedPastedViews[vid].originLayout();
         Data::Layout originlayout = m_handler->layoutsController()->originalData(origincurrentid);
         Latte::CentralLayout *origin = m_handler->layoutsController()->centralLayout(originlayout.id);
 
@@ -944,8 +1104,8 @@ void Views::save()
     }
 
     //! move active views between different active layouts
-    for (const auto vid: cuttedpastedactiveviews.keys()) {
-        Data::View pastedactiveview = cuttedpastedactiveviews[vid];
+    for (const auto vid: transaction.cuttedPastedActiveViews.keys()) {
+        Data::View pastedactiveview = transaction.cuttedPastedActiveViews[vid];
         uint originviewid = pastedactiveview.originView().toUInt();
         CentralLayout *origin = originLayout(pastedactiveview);
         QString originlayoutname = origin->name();
@@ -956,7 +1116,7 @@ void Views::save()
         QString tempviewid = pastedactiveview.id;
         pastedactiveview.id = QString::number(originviewid);
 
-        qDebug() << "org.kde.latte ViewsDialog::save() move to another layout cutted-pasted active view :: " << pastedactiveview;
+        reportSaveProgress(transaction, "move to another layout cutted-pasted active view", pastedactiveview);
 
         if (view) {
             //! onscreen_view->onscreen_view
@@ -972,21 +1132,21 @@ void Views::save()
         }
 
         pastedactiveview.setState(Data::View::IsCreated, QString(), QString(), QString());
-        newviewsresponses[tempviewid] = pastedactiveview;
+        transaction.newViewsResponses[tempviewid] = pastedactiveview;
     }
 
     //! update
-    if ((removedViews.rowCount() > 0) || (newViews.rowCount() > 0)) {
+    if ((transaction.removedViews.rowCount() > 0) || transaction.hasNewViews) {
         m_handler->corona()->layoutsManager()->synchronizer()->syncActiveLayoutsToOriginalFiles();
     }
 
     //! update model for newly added views
-    for (const auto vid: newviewsresponses.keys()) {
-        m_model->setOriginalView(vid, newviewsresponses[vid]);
+    for (const auto vid: transaction.newViewsResponses.keys()) {
+        m_model->setOriginalView(vid, transaction.newViewsResponses[vid]);
     }
 
     //! update all table with latest data and make the original one
-    currentViews = m_model->currentViewsData();
+    Latte::Data::ViewsTable currentViews = m_model->currentViewsData();
     m_model->setOriginalData(currentViews);
 
     //! update model activeness
@@ -996,6 +1156,13 @@ void Views::save()
 
     //! Clear any templates keeper data in order to produce reupdates if needed
     m_handler->layoutsController()->templatesKeeper()->clear();
+
+    invalidateErrorsWarnings(central->file());
+
+    m_view->setUpdatesEnabled(true);
+    QApplication::restoreOverrideCursor();
+
+    return true;
 }
 
 QString Views::uniqueViewName(QString name)
@@ -10,17 +10,20 @@
 #include <coretypes.h>
 #include "viewsmodel.h"
 #include "../../lattecorona.h"
+#include "../../data/errordata.h"
 #include "../../data/viewdata.h"
 #include "../../data/viewstable.h"
 
 // Qt
 #include <QAbstractItemModel>
+#include <QDateTime>
 #include <QHash>
 #include <QItemSelection>
 #include <QList>
 #include <QMetaObject>
 #include <QSortFilterProxyModel>
 #include <QTableView>
+#include <QTimer>
 
 // KDE
 #include <KMessageWidget>
@@ -73,7 +76,7 @@ public:
 
     //! actions
     void reset();
-    void save();
+    bool save();
 
 public slots:
     void copySelectedViews();
@@ -86,8 +89,33 @@ signals:
     void dataChanged();
 
 private:
+    //! all changes that a save applies, they are computed and validated before any of them is applied
+    struct SaveTransaction
+    {
+        Latte::CentralLayout *central{nullptr};
+
+        Data::ViewsTable newViews;
+        Data::ViewsTable alteredViews;
+        Data::ViewsTable removedViews;
+        QHash<QString, Data::View> cuttedPastedViews;
+        QHash<QString, Data::View> cuttedPastedActiveViews;
+        bool hasNewViews{false};
+
+        //! views created while applying, they are removed when the transaction is rolled back
+        Data::ViewsTable createdViews;
+        QHash<QString, Data::View> newViewsResponses;
+
+        int step{0};
+        int steps{0};
+        QString error;
+    };
+
     void init();
 
+    bool prepareSaveTransaction(SaveTransaction &transaction);
+    void reportSaveProgress(SaveTransaction &transaction, const QString &step, const Data::View &view);
+    void rollbackSaveTransaction(SaveTransaction &transaction);
+
     bool hasValidOriginView(const Data::View &view);
     CentralLayout *originLayout(const Data::View &view);
 
@@ -98,6 +126,20 @@ private:
     Data::ViewsTable selectedViewsForClipboard();
 
     //! errors/warnings
+    //! validation results of an inactive layout, they are reused while its file is unchanged.
+    //! Active layouts are validated against their live containments and are never cached
+    struct ErrorsWarningsValidation
+    {
+        qint64 size{0};
+        QDateTime lastModified;
+        Data::ErrorsList errors;
+        Data::WarningsList warnings;
+    };
+
+    bool hasValidErrorsWarnings(const Latte::CentralLayout *centralLayout) const;
+    void invalidateErrorsWarnings(const QString &layoutId);
+    void showErrorsWarnings(const QString &layoutId, const ErrorsWarningsValidation &validation, const bool &showNoErrorsMessage);
+
     void messagesForErrorsWarnings(const Latte::CentralLayout *centralLayout, const bool &showNoErrorsMessage = false);
     void messageForErrorAppletsWithSameId(const Data::Error &error);
     void messageForErrorOrphanedParentAppletOfSubContainment(const Data::Error &error);
@@ -122,6 +164,8 @@ private slots:
 
     void updateDoubledMoveDestinationRows();
 
+    void validatePendingLayout();
+
 private:
     Settings::Handler::ViewsHandler *m_handler{nullptr};
 
@@ -132,6 +176,12 @@ private:
     //! current active layout signals/slots
     QList<QMetaObject::Connection> m_currentLayoutConnections;
 
+    //! layout id, validation
+    QHash<QString, ErrorsWarningsValidation> m_errorsWarnings;
+    QString m_pendingErrorsWarningsLayoutId;
+    bool m_pendingShowNoErrorsMessage{false};
+    QTimer m_errorsWarningsTimer;
+
     //! layoutsView ui settings
     int m_viewSortColumn{Model::Views::SCREENCOLUMN};
     Qt::SortOrder m_viewSortOrder;
@@ -465,10 +465,9 @@ void ViewsHandler::onCurrentLayoutIndexChanged(int row)
                 int removalviews = m_viewsController->viewsForRemovalCount();
                 KMessageBox::ButtonCode removalresponse = removalConfirmation(removalviews);
 
-                if (removalresponse == KMessageBox::Yes) {
+                if (removalresponse == KMessageBox::Yes && m_viewsController->save()) {
                     switchtonewlayout = true;
                     m_lastConfirmedLayoutIndex = row;
-                    m_viewsController->save();
                 } else {
                     //do nothing
                 }
@@ -396,22 +396,66 @@ void Views::updateActiveStatesBasedOn(const CentralLayout *layout)
         return;
     }
 
-    QVector<int> roles;
-    roles << Qt::DisplayRole;
-    roles << Qt::UserRole;
-    roles << ISCHANGEDROLE;
-    roles << ISACTIVEROLE;
-    roles << HASCHANGEDVIEWROLE;
+    QVector<RowState> previous = rowStates();
 
     for (int i=0; i<m_viewsTable.rowCount(); ++i) {
         uint viewid = m_viewsTable[i].id.toUInt();
         auto view = layout->viewForContainment(viewid);
 
-        bool currentactivestate = (view != nullptr);
+        m_viewsTable[i].isActive = (view != nullptr);
+    }
+
+    emitRowChanges(previous);
+}
+
+QVector<Views::RowState> Views::rowStates() const
+{
+    QVector<RowState> states;
+    states.reserve(m_viewsTable.rowCount());
+
+    for (int i=0; i<m_viewsTable.rowCount(); ++i) {
+        RowState state;
+        state.isActive = m_viewsTable[i].isActive;
+        state.isMoveOrigin = m_viewsTable[i].isMoveOrigin;
+        state.errors = m_viewsTable[i].errors;
+        state.warnings = m_viewsTable[i].warnings;
+        states << state;
+    }
+
+    return states;
+}
+
+void Views::emitRowChanges(const QVector<RowState> &previous)
+{
+    if (previous.count() != m_viewsTable.rowCount()) {
+        //! rows were added or removed meanwhile, their notifications are already sent
+        return;
+    }
+
+    for (int i=0; i<m_viewsTable.rowCount(); ++i) {
+        //! active and move origin states are painted by every cell
+        QVector<int> rowRoles;
+        //! errors and warnings are shown only by name cells
+        QVector<int> nameRoles;
+
+        if (previous[i].isActive != m_viewsTable[i].isActive) {
+            rowRoles << ISACTIVEROLE;
+            rowRoles << SORTINGROLE;
+        }
+
+        if (previous[i].isMoveOrigin != m_viewsTable[i].isMoveOrigin) {
+            rowRoles << ISMOVEORIGINROLE;
+        }
+
+        if (previous[i].errors != m_viewsTable[i].errors || previous[i].warnings != m_viewsTable[i].warnings) {
+            nameRoles << ERRORSROLE;
+            nameRoles << WARNINGSROLE;
+        }
 
-        if (currentactivestate != m_viewsTable[i].isActive) {
-            m_viewsTable[i].isActive = currentactivestate;
-            emit dataChanged(this->index(i, IDCOLUMN), this->index(i, SUBCONTAINMENTSCOLUMN), roles);
+        if (!rowRoles.isEmpty()) {
+            emit dataChanged(this->index(i, IDCOLUMN), this->index(i, SUBCONTAINMENTSCOLUMN), rowRoles + nameRoles);
+        } else if (!nameRoles.isEmpty()) {
+            emit dataChanged(this->index(i, NAMECOLUMN), this->index(i, NAMECOLUMN), nameRoles);
         }
     }
 }
@@ -479,18 +523,14 @@ Latte::Data::ViewsTable Views::newViews() const
 
 void Views::clearErrorsAndWarnings()
 {
+    QVector<RowState> previous = rowStates();
+
     for(int i=0; i<m_viewsTable.rowCount(); ++i) {
         m_viewsTable[i].errors = 0;
         m_viewsTable[i].warnings = 0;
     }
 
-    QVector<int> roles;
-    roles << Qt::DisplayRole;
-    roles << Qt::UserRole;
-    roles << ERRORSROLE;
-    roles << WARNINGSROLE;
-
-    emit dataChanged(this->index(0, IDCOLUMN), this->index(m_viewsTable.rowCount()-1, SUBCONTAINMENTSCOLUMN), roles);
+    emitRowChanges(previous);
 }
 
 void Views::populateScreens()
@@ -522,6 +562,15 @@ void Views::updateCurrentView(QString currentViewId, Latte::Data::View &view)
     }
 
     int currentrow = m_viewsTable.indexOf(currentViewId);
+
+    if (m_viewsTable[currentrow] == view) {
+        //! only states that are not part of view data changed
+        QVector<RowState> previous = rowStates();
+        m_viewsTable[currentrow] = view;
+        emitRowChanges(previous);
+        return;
+    }
+
     m_viewsTable[currentrow] = view;
 
     QVector<int> roles;
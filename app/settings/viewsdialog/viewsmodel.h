@@ -22,6 +22,7 @@
 // Qt
 #include <QAbstractTableModel>
 #include <QModelIndex>
+#include <QVector>
 
 namespace Latte {
 namespace Settings {
@@ -140,6 +141,18 @@ private:
 
     Latte::Data::Screen screenData(const QString &viewId) const;
 
+    struct RowState
+    {
+        bool isActive{false};
+        bool isMoveOrigin{false};
+        int errors{0};
+        int warnings{0};
+    };
+
+    //! state snapshots that are compared in order to notify only the cells and roles that changed
+    QVector<RowState> rowStates() const;
+    void emitRowChanges(const QVector<RowState> &previous);
+
 private:
     Latte::Data::ViewsTable m_viewsTable;
     Latte::Data::ViewsTable o_viewsTable;
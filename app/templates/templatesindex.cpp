@@ -0,0 +1,97 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "templatesindex.h"
+
+// local
+#include "../layout/abstractlayout.h"
+
+// Qt
+#include <QDir>
+#include <QFileInfo>
+
+// KDE
+#include <KConfig>
+#include <KConfigGroup>
+
+namespace Latte {
+namespace Templates {
+
+Data::Layout Index::layoutTemplate(const QString &path)
+{
+    QFileInfo fileInfo(path);
+
+    if (m_entries.contains(path)) {
+        const Entry &entry = m_entries[path];
+
+        if (entry.size == fileInfo.size() && entry.lastModified == fileInfo.lastModified()) {
+            return entry.data;
+        }
+    }
+
+    Entry entry;
+    entry.size = fileInfo.size();
+    entry.lastModified = fileInfo.lastModified();
+    entry.data = scanLayoutTemplate(path);
+
+    m_entries[path] = entry;
+
+    return entry.data;
+}
+
+void Index::remove(const QString &path)
+{
+    m_entries.remove(path);
+}
+
+Data::Layout Index::scanLayoutTemplate(const QString &path)
+{
+    Data::Layout tdata;
+    tdata.id = path;
+    tdata.name = Layout::AbstractLayout::layoutName(path);
+    tdata.isTemplate = true;
+
+    //! plain config parsing, no CentralLayout is needed in order to read the layout settings
+    KConfig config(path, KConfig::SimpleConfig);
+    KConfigGroup settings(&config, "LayoutSettings");
+
+    //! same defaults and conversions as AbstractLayout::loadConfig() and CentralLayout::loadConfig()
+    tdata.icon = settings.readEntry("icon", QString());
+    tdata.color = settings.readEntry("color", QString("blue"));
+    tdata.backgroundStyle = static_cast<Layout::BackgroundStyle>(settings.readEntry("backgroundStyle", (int)Layout::ColorBackgroundStyle));
+    tdata.lastUsedActivity = settings.readEntry("lastUsedActivity", QString());
+    tdata.popUpMargin = settings.readEntry("popUpMargin", -1);
+    tdata.isShownInMenu = settings.readEntry("showInMenu", false);
+    tdata.hasDisabledBorders = settings.readEntry("disableBordersForMaximizedWindows", false);
+    tdata.activities = settings.readEntry("activities", QStringList());
+
+    QString deprecatedBackground = settings.readEntry("background", QString());
+
+    if (deprecatedBackground.startsWith("/")) {
+        tdata.background = deprecatedBackground;
+        tdata.textColor = settings.readEntry("textColor", QString());
+        tdata.backgroundStyle = Layout::PatternBackgroundStyle;
+    } else {
+        tdata.background = settings.readEntry("customBackground", QString());
+        tdata.textColor = settings.readEntry("customTextColor", QString());
+    }
+
+    QString schemeFile = settings.readEntry("schemeFile", QString(Data::Layout::DEFAULTSCHEMEFILE));
+
+    if (schemeFile.startsWith("~")) {
+        schemeFile.remove(0, 1);
+        schemeFile = QDir::homePath() + schemeFile;
+    }
+
+    tdata.schemeFile = schemeFile.isEmpty() || !QFileInfo(schemeFile).exists() ? Data::Layout::DEFAULTSCHEMEFILE : schemeFile;
+
+    QFileInfo fileInfo(path);
+    tdata.isLocked = fileInfo.exists() && !fileInfo.isWritable();
+
+    return tdata;
+}
+
+}
+}
@@ -0,0 +1,48 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef TEMPLATESINDEX_H
+#define TEMPLATESINDEX_H
+
+// local
+#include "../data/layoutdata.h"
+
+// Qt
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+
+namespace Latte {
+namespace Templates {
+
+//! Keeps the layout templates metadata that are needed for menus and dialogs.
+//! Only the [LayoutSettings] group of each template file is read through KConfig,
+//! no layout objects or containments are created. Entries are revalidated
+//! by file size and modification time, so unchanged templates are never rescanned.
+//! Full parsing happens only when a template is applied and becomes a real layout.
+class Index
+{
+public:
+    Data::Layout layoutTemplate(const QString &path);
+
+    void remove(const QString &path);
+
+    static Data::Layout scanLayoutTemplate(const QString &path);
+
+private:
+    struct Entry
+    {
+        qint64 size{0};
+        QDateTime lastModified;
+        Data::Layout data;
+    };
+
+    QHash<QString, Entry> m_entries;
+};
+
+}
+}
+
+#endif
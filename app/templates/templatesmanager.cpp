@@ -7,7 +7,6 @@
 
 // local
 #include "../layout/abstractlayout.h"
-#include "../layout/centrallayout.h"
 #include "../layouts/importer.h"
 #include "../layouts/manager.h"
 #include "../layouts/storage.h"
@@ -16,6 +15,7 @@
 
 // Qt
 #include <QDir>
+#include <QFile>
 
 // KDE
 #include <KDirWatch>
@@ -41,28 +41,72 @@ Manager::~Manager()
 void Manager::init()
 {
     connect(this, &Manager::viewTemplatesChanged, m_corona->layoutsManager(), &Latte::Layouts::Manager::viewTemplatesChanged);
+}
 
-    initLayoutTemplates();
-    initViewTemplates();
+bool Manager::isLoaded() const
+{
+    return m_isLoaded;
 }
 
-void Manager::initLayoutTemplates()
+void Manager::load()
+{
+    if (m_isLoaded) {
+        return;
+    }
+
+    loadTemplates();
+
+    emit layoutTemplatesChanged();
+    emit viewTemplatesChanged();
+}
+
+void Manager::ensureLoaded() const
+{
+    if (m_isLoaded) {
+        return;
+    }
+
+    //! scanning templates is not part of the startup critical path,
+    //! the first consumer that needs them triggers their loading.
+    //! Consumers only read them, so nothing is announced as changed
+    loadTemplates();
+}
+
+void Manager::loadTemplates() const
+{
+    m_isLoaded = true;
+
+    scanLayoutTemplates();
+    scanViewTemplates();
+}
+
+void Manager::scanLayoutTemplates() const
 {
     m_layoutTemplates.clear();
     initLayoutTemplates(m_corona->kPackage().filePath("templates"));
     initLayoutTemplates(Latte::configPath() + "/latte/templates");
-    emit layoutTemplatesChanged();
 }
 
-void Manager::initViewTemplates()
+void Manager::scanViewTemplates() const
 {
     m_viewTemplates.clear();
     initViewTemplates(m_corona->kPackage().filePath("templates"));
     initViewTemplates(Latte::configPath() + "/latte/templates");
+}
+
+void Manager::initLayoutTemplates()
+{
+    scanLayoutTemplates();
+    emit layoutTemplatesChanged();
+}
+
+void Manager::initViewTemplates()
+{
+    scanViewTemplates();
     emit viewTemplatesChanged();
 }
 
-void Manager::initLayoutTemplates(const QString &path)
+void Manager::initLayoutTemplates(const QString &path) const
 {
     QDir templatesDir(path);
     QStringList filter;
@@ -72,10 +116,8 @@ void Manager::initLayoutTemplates(const QString &path)
     for (int i=0; i<templates.count(); ++i) {
         QString templatePath = templatesDir.path() + "/" + templates[i];
         if (!m_layoutTemplates.containsId(templatePath)) {
-            CentralLayout layouttemplate(this, templatePath);
-
-            Data::Layout tdata = layouttemplate.data();
-            tdata.isTemplate = true;
+            //! only the template metadata are needed, layouts are parsed when templates are applied
+            Data::Layout tdata = m_index.layoutTemplate(templatePath);
 
             if (tdata.name == DEFAULTLAYOUTTEMPLATENAME || tdata.name == EMPTYLAYOUTTEMPLATENAME) {
                 QByteArray templateNameChars = tdata.name.toUtf8();
@@ -87,7 +129,7 @@ void Manager::initLayoutTemplates(const QString &path)
     }
 }
 
-void Manager::initViewTemplates(const QString &path)
+void Manager::initViewTemplates(const QString &path) const
 {
     bool istranslated = (m_corona->kPackage().filePath("templates") == path);
 
@@ -118,6 +160,8 @@ void Manager::initViewTemplates(const QString &path)
 
 Data::Layout Manager::layoutTemplateForName(const QString &layoutName)
 {
+    ensureLoaded();
+
     if (m_layoutTemplates.containsName(layoutName)) {
         QString layoutid = m_layoutTemplates.idForName(layoutName);
         return m_layoutTemplates[layoutid];
@@ -128,6 +172,8 @@ Data::Layout Manager::layoutTemplateForName(const QString &layoutName)
 
 Data::LayoutsTable Manager::layoutTemplates()
 {
+    ensureLoaded();
+
     Data::LayoutsTable templates;
 
     QString id = m_layoutTemplates.idForName(i18n(DEFAULTLAYOUTTEMPLATENAME));
@@ -148,11 +194,15 @@ Data::LayoutsTable Manager::layoutTemplates()
 
 Data::GenericBasicTable Manager::viewTemplates()
 {
+    ensureLoaded();
+
     return m_viewTemplates;
 }
 
 QString Manager::newLayout(QString layoutName, QString layoutTemplate)
 {
+    ensureLoaded();
+
     if (!m_layoutTemplates.containsName(layoutTemplate)) {
         return QString();
     }
@@ -186,8 +236,17 @@ bool Manager::exportTemplate(const Latte::View *view, const QString &destination
 
 void Manager::onCustomTemplatesCountChanged(const QString &file)
 {
+    if (!m_isLoaded) {
+        //! all templates will be scanned when they are loaded
+        return;
+    }
+
     if (file.startsWith(Latte::configPath() + "/latte/templates")) {
         if (file.endsWith(".layout.latte")) {
+            if (!QFile(file).exists()) {
+                m_index.remove(file);
+            }
+
             initLayoutTemplates();
         } else if (file.endsWith(".view.latte")) {
             initViewTemplates();
@@ -197,6 +256,8 @@ void Manager::onCustomTemplatesCountChanged(const QString &file)
 
 void Manager::importSystemLayouts()
 {
+    ensureLoaded();
+
     for (int i=0; i<m_layoutTemplates.rowCount(); ++i) {
         if (m_layoutTemplates[i].isSystemTemplate()) {
             QString userLayoutPath = Layouts::Importer::layoutUserFilePath(m_layoutTemplates[i].name);
@@ -226,6 +287,8 @@ QString Manager::proposedTemplateAbsolutePath(QString templateFilename)
 
 bool Manager::hasCustomLayoutTemplate(const QString &templateName) const
 {
+    ensureLoaded();
+
     for (int i=0; i<m_layoutTemplates.rowCount(); ++i) {
         if (m_layoutTemplates[i].name == templateName && !m_layoutTemplates[i].isSystemTemplate()) {
             return true;
@@ -237,16 +300,22 @@ bool Manager::hasCustomLayoutTemplate(const QString &templateName) const
 
 bool Manager::hasLayoutTemplate(const QString &templateName) const
 {
+    ensureLoaded();
+
     return m_layoutTemplates.containsName(templateName);
 }
 
 bool Manager::hasViewTemplate(const QString &templateName) const
 {
+    ensureLoaded();
+
     return m_viewTemplates.containsName(templateName);
 }
 
 QString Manager::viewTemplateFilePath(const QString templateName) const
 {
+    ensureLoaded();
+
     if (m_viewTemplates.containsName(templateName)) {
         return m_viewTemplates.idForName(templateName);
     }
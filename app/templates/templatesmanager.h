@@ -7,6 +7,7 @@
 #define TEMPLATESMANAGER_H
 
 // local
+#include "templatesindex.h"
 #include "../lattecorona.h"
 #include "../data/appletdata.h"
 #include "../data/layoutdata.h"
@@ -41,6 +42,10 @@ public:
     Latte::Corona *corona();
     void init();
 
+    //! templates are scanned on first use or during idle time after startup
+    bool isLoaded() const;
+    void load();
+
     bool hasCustomLayoutTemplate(const QString &templateName) const;
     bool hasLayoutTemplate(const QString &templateName) const;
     bool hasViewTemplate(const QString &templateName) const;
@@ -74,11 +79,19 @@ private slots:
     void onCustomTemplatesCountChanged(const QString &file);
 
 private:
+    void ensureLoaded() const;
+    void loadTemplates() const;
+
+    //! rescan and announce the changed templates
     void initLayoutTemplates();
     void initViewTemplates();
 
-    void initLayoutTemplates(const QString &path);
-    void initViewTemplates(const QString &path);
+    //! rescan only, they are used by the lazy loading from const accessors
+    void scanLayoutTemplates() const;
+    void scanViewTemplates() const;
+
+    void initLayoutTemplates(const QString &path) const;
+    void initViewTemplates(const QString &path) const;
 
     void exposeTranslatedTemplateNames();
 
@@ -86,10 +99,15 @@ private:
     QString uniqueViewTemplateName(QString name) const;
 
 private:
+    //! templates are loaded lazily, also from const accessors
+    mutable bool m_isLoaded{false};
+
     Latte::Corona *m_corona;
 
-    Data::LayoutsTable m_layoutTemplates;
-    Data::GenericBasicTable m_viewTemplates;
+    mutable Index m_index;
+
+    mutable Data::LayoutsTable m_layoutTemplates;
+    mutable Data::GenericBasicTable m_viewTemplates;
 
 };
 
@@ -0,0 +1,235 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "tracer.h"
+
+// Qt
+#include <QTest>
+
+using namespace Latte;
+
+class TracerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void disabledRecordsNothing();
+    void eventsAreKeptInOrder();
+    void eventsWrapAroundAtCapacity();
+    void spanKeepsEarliestBegin();
+    void spansArePairedPerView();
+    void unpairedSpansAreIgnored();
+    void cancelledSpanIsNotSampled();
+    void spanSamplesAreBounded();
+    void percentiles_data();
+    void percentiles();
+    void latenciesReport();
+
+private:
+    //! event descriptions without their timestamps
+    QStringList eventNames() const;
+};
+
+QStringList TracerTest::eventNames() const
+{
+    QStringList names;
+
+    for (const auto &event : Tracer::self()->events()) {
+        names << event.section(" :: ", -1);
+    }
+
+    return names;
+}
+
+void TracerTest::init()
+{
+    Tracer::self()->setEnabled(true);
+    Tracer::self()->clear();
+}
+
+void TracerTest::cleanup()
+{
+    Tracer::self()->setEnabled(false);
+}
+
+void TracerTest::disabledRecordsNothing()
+{
+    Tracer::self()->setEnabled(false);
+
+    Tracer::self()->record(1, "visibility", "show");
+    Tracer::self()->beginSpan(1, "show", "mouse");
+    Tracer::self()->endSpan(1, "show");
+
+    QVERIFY(Tracer::self()->events().isEmpty());
+    QVERIFY(Tracer::self()->spanSamples("show").isEmpty());
+}
+
+void TracerTest::eventsAreKeptInOrder()
+{
+    Tracer::self()->record(1, "visibility", "show");
+    Tracer::self()->record(2, "positioner", "slide");
+
+    const QStringList events = Tracer::self()->events();
+    QCOMPARE(events.count(), 2);
+    QVERIFY(events[0].contains(":: view 1 :: visibility :: show"));
+    QVERIFY(events[1].contains(":: view 2 :: positioner :: slide"));
+}
+
+void TracerTest::eventsWrapAroundAtCapacity()
+{
+    const int overflow = 10;
+
+    for (int i=0; i<Tracer::CAPACITY + overflow; ++i) {
+        Tracer::self()->record(1, "test", QString::number(i));
+    }
+
+    const QStringList names = eventNames();
+    QCOMPARE(names.count(), Tracer::CAPACITY);
+
+    //! the oldest events are overwritten and the rest remain in order
+    for (int i=0; i<names.count(); ++i) {
+        QCOMPARE(names[i], QString::number(i + overflow));
+    }
+
+    qint64 previous{-1};
+
+    for (const auto &event : Tracer::self()->events()) {
+        qint64 timestamp = event.section(" us", 0, 0).toLongLong();
+        QVERIFY(timestamp >= previous);
+        previous = timestamp;
+    }
+}
+
+void TracerTest::spanKeepsEarliestBegin()
+{
+    Tracer::self()->beginSpan(1, "show", "first");
+    QTest::qWait(20);
+    Tracer::self()->beginSpan(1, "show", "second");
+    QTest::qWait(20);
+    Tracer::self()->endSpan(1, "show");
+
+    const QVector<qint64> samples = Tracer::self()->spanSamples("show");
+    QCOMPARE(samples.count(), 1);
+
+    //! coarse timers can fire up to 5% earlier
+    QVERIFY(samples[0] >= 40000 * 0.95);
+
+    QCOMPARE(eventNames().filter("started").count(), 1);
+    QVERIFY(eventNames()[0].contains("started from first"));
+}
+
+void TracerTest::spansArePairedPerView()
+{
+    Tracer::self()->beginSpan(1, "show", "mouse");
+    Tracer::self()->beginSpan(2, "show", "mouse");
+    Tracer::self()->beginSpan(1, "hide", "timer");
+
+    Tracer::self()->endSpan(2, "show");
+    Tracer::self()->endSpan(1, "show");
+    Tracer::self()->endSpan(1, "hide");
+
+    QCOMPARE(Tracer::self()->spanSamples("show").count(), 2);
+    QCOMPARE(Tracer::self()->spanSamples("hide").count(), 1);
+
+    //! spans that finished can be started again
+    Tracer::self()->beginSpan(1, "show", "mouse");
+    Tracer::self()->endSpan(1, "show");
+    QCOMPARE(Tracer::self()->spanSamples("show").count(), 3);
+}
+
+void TracerTest::unpairedSpansAreIgnored()
+{
+    Tracer::self()->endSpan(1, "show");
+    QVERIFY(Tracer::self()->spanSamples("show").isEmpty());
+
+    Tracer::self()->beginSpan(1, "show", "mouse");
+    Tracer::self()->endSpan(2, "show");
+    Tracer::self()->endSpan(1, "hide");
+    QVERIFY(Tracer::self()->spanSamples("show").isEmpty());
+    QVERIFY(Tracer::self()->spanSamples("hide").isEmpty());
+
+    Tracer::self()->endSpan(1, "show");
+    Tracer::self()->endSpan(1, "show");
+    QCOMPARE(Tracer::self()->spanSamples("show").count(), 1);
+}
+
+void TracerTest::cancelledSpanIsNotSampled()
+{
+    Tracer::self()->beginSpan(1, "show", "mouse");
+    Tracer::self()->cancelSpan(1, "show");
+    Tracer::self()->endSpan(1, "show");
+
+    QVERIFY(Tracer::self()->spanSamples("show").isEmpty());
+}
+
+void TracerTest::spanSamplesAreBounded()
+{
+    const int overflow = 10;
+
+    for (int i=0; i<Tracer::SPANSAMPLES + overflow; ++i) {
+        Tracer::self()->beginSpan(1, "show", "mouse");
+        Tracer::self()->endSpan(1, "show");
+    }
+
+    QCOMPARE(Tracer::self()->spanSamples("show").count(), Tracer::SPANSAMPLES);
+}
+
+void TracerTest::percentiles_data()
+{
+    QTest::addColumn<QVector<qint64>>("samples");
+    QTest::addColumn<double>("ratio");
+    QTest::addColumn<qint64>("expected");
+
+    QVector<qint64> hundred;
+
+    //! shuffled on purpose, percentiles sort their samples
+    for (int i=100; i>=1; --i) {
+        hundred << i;
+    }
+
+    QTest::newRow("empty") << QVector<qint64>() << 0.5 << qint64(0);
+    QTest::newRow("single p50") << QVector<qint64>({7}) << 0.5 << qint64(7);
+    QTest::newRow("single p99") << QVector<qint64>({7}) << 0.99 << qint64(7);
+    QTest::newRow("hundred p50") << hundred << 0.5 << qint64(50);
+    QTest::newRow("hundred p99") << hundred << 0.99 << qint64(99);
+    QTest::newRow("hundred max") << hundred << 1.0 << qint64(100);
+    QTest::newRow("hundred min") << hundred << 0.0 << qint64(1);
+    QTest::newRow("odd p50") << QVector<qint64>({30, 10, 20}) << 0.5 << qint64(20);
+    QTest::newRow("even p50") << QVector<qint64>({40, 10, 30, 20}) << 0.5 << qint64(20);
+    QTest::newRow("few p99") << QVector<qint64>({5, 1000, 10}) << 0.99 << qint64(1000);
+}
+
+void TracerTest::percentiles()
+{
+    QFETCH(QVector<qint64>, samples);
+    QFETCH(double, ratio);
+    QFETCH(qint64, expected);
+
+    QCOMPARE(Tracer::percentile(samples, ratio), expected);
+}
+
+void TracerTest::latenciesReport()
+{
+    for (int i=0; i<3; ++i) {
+        Tracer::self()->beginSpan(1, "show", "mouse");
+        Tracer::self()->endSpan(1, "show");
+    }
+
+    const QStringList latencies = Tracer::self()->latencies();
+    QCOMPARE(latencies.count(), 1);
+    QVERIFY(latencies[0].startsWith("show :: samples 3 :: p50 "));
+
+    Tracer::self()->clear();
+    QVERIFY(Tracer::self()->latencies().isEmpty());
+    QVERIFY(Tracer::self()->events().isEmpty());
+}
+
+QTEST_GUILESS_MAIN(TracerTest)
+
+#include "tracertest.moc"
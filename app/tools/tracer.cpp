@@ -0,0 +1,191 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "tracer.h"
+
+// C++
+#include <algorithm>
+
+// Qt
+#include <QDebug>
+#include <QtMath>
+
+namespace Latte {
+
+Tracer::Tracer()
+{
+    m_clock.start();
+}
+
+Tracer::~Tracer()
+{
+}
+
+Tracer *Tracer::self()
+{
+    static Tracer tracer;
+    return &tracer;
+}
+
+bool Tracer::isEnabled() const
+{
+    return m_isEnabled;
+}
+
+void Tracer::setEnabled(bool enabled)
+{
+    if (m_isEnabled == enabled) {
+        return;
+    }
+
+    m_isEnabled = enabled;
+
+    if (m_isEnabled) {
+        m_events.resize(CAPACITY);
+    } else {
+        clear();
+        m_events.clear();
+        m_events.squeeze();
+    }
+}
+
+void Tracer::printToDebug(const QString &category)
+{
+    if (!m_debugCategories.contains(category)) {
+        m_debugCategories << category;
+    }
+}
+
+qint64 Tracer::now() const
+{
+    return m_clock.nsecsElapsed() / 1000;
+}
+
+void Tracer::record(const int &viewId, const QString &category, const QString &event)
+{
+    if (!m_isEnabled) {
+        return;
+    }
+
+    TraceEvent &record = m_events[m_next];
+    record.timestamp = now();
+    record.viewId = viewId;
+    record.category = category;
+    record.event = event;
+
+    m_next = (m_next + 1) % CAPACITY;
+    m_count = qMin(m_count + 1, CAPACITY);
+
+    if (m_debugCategories.contains(category)) {
+        qDebug() << "Trace ::" << category << ":: view:" << viewId << " at:" << record.timestamp / 1000 << "ms ::" << event;
+    }
+}
+
+void Tracer::beginSpan(const int &viewId, const QString &span, const QString &trigger)
+{
+    if (!m_isEnabled) {
+        return;
+    }
+
+    QPair<int, QString> key(viewId, span);
+
+    if (m_activeSpans.contains(key)) {
+        return;
+    }
+
+    m_activeSpans[key] = now();
+    record(viewId, "span", QString("%1 started from %2").arg(span).arg(trigger));
+}
+
+void Tracer::endSpan(const int &viewId, const QString &span)
+{
+    if (!m_isEnabled) {
+        return;
+    }
+
+    QPair<int, QString> key(viewId, span);
+
+    if (!m_activeSpans.contains(key)) {
+        return;
+    }
+
+    qint64 latency = now() - m_activeSpans.take(key);
+
+    QVector<qint64> &samples = m_spanSamples[span];
+
+    if (samples.count() >= SPANSAMPLES) {
+        samples.removeFirst();
+    }
+
+    samples << latency;
+
+    record(viewId, "span", QString("%1 finished after %2 us").arg(span).arg(latency));
+}
+
+void Tracer::cancelSpan(const int &viewId, const QString &span)
+{
+    if (!m_isEnabled) {
+        return;
+    }
+
+    m_activeSpans.remove(QPair<int, QString>(viewId, span));
+}
+
+void Tracer::clear()
+{
+    m_next = 0;
+    m_count = 0;
+    m_activeSpans.clear();
+    m_spanSamples.clear();
+}
+
+QStringList Tracer::events() const
+{
+    QStringList result;
+
+    int first = (m_count < CAPACITY) ? 0 : m_next;
+
+    for (int i=0; i<m_count; ++i) {
+        const TraceEvent &record = m_events[(first + i) % CAPACITY];
+        result << QString("%1 us :: view %2 :: %3 :: %4").arg(record.timestamp).arg(record.viewId).arg(record.category).arg(record.event);
+    }
+
+    return result;
+}
+
+QVector<qint64> Tracer::spanSamples(const QString &span) const
+{
+    return m_spanSamples.value(span);
+}
+
+qint64 Tracer::percentile(QVector<qint64> samples, const double &ratio)
+{
+    if (samples.isEmpty()) {
+        return 0;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    int index = qBound(0, qCeil(ratio * samples.count()) - 1, samples.count() - 1);
+    return samples[index];
+}
+
+QStringList Tracer::latencies() const
+{
+    QStringList result;
+
+    for (auto i = m_spanSamples.constBegin(); i != m_spanSamples.constEnd(); ++i) {
+        result << QString("%1 :: samples %2 :: p50 %3 us :: p99 %4 us :: max %5 us")
+                  .arg(i.key())
+                  .arg(i.value().count())
+                  .arg(percentile(i.value(), 0.50))
+                  .arg(percentile(i.value(), 0.99))
+                  .arg(percentile(i.value(), 1.0));
+    }
+
+    return result;
+}
+
+}
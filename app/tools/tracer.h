@@ -0,0 +1,90 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace Latte {
+
+struct TraceEvent
+{
+    qint64 timestamp{0}; //in microseconds since tracer creation
+    int viewId{-1};
+    QString category;
+    QString event;
+};
+
+//! Lightweight tracing facility for views visibility, positioner slide animations
+//! and windows tracker. Events are kept in a fixed size ring buffer and show/hide
+//! latency spans are collected in order to report their percentiles. It is disabled
+//! by default and it is enabled with the --trace option.
+class Tracer
+{
+
+public:
+    static constexpr int CAPACITY = 4096;
+    static constexpr int SPANSAMPLES = 1024;
+
+    static Tracer *self();
+    ~Tracer();
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    //! events of the category are also printed as debug messages when they are recorded
+    void printToDebug(const QString &category);
+
+    void record(const int &viewId, const QString &category, const QString &event);
+
+    //! latency spans, a span is started once and the earliest trigger is kept
+    void beginSpan(const int &viewId, const QString &span, const QString &trigger);
+    void endSpan(const int &viewId, const QString &span);
+    void cancelSpan(const int &viewId, const QString &span);
+
+    void clear();
+
+    //! latency samples of the span in microseconds, oldest first
+    QVector<qint64> spanSamples(const QString &span) const;
+
+    //! human readable dumps, used through D-Bus
+    QStringList events() const;
+    QStringList latencies() const;
+
+    //! nearest-rank percentile, ratio is in [0, 1]
+    static qint64 percentile(QVector<qint64> samples, const double &ratio);
+
+private:
+    Tracer();
+
+    qint64 now() const;
+
+private:
+    bool m_isEnabled{false};
+
+    int m_next{0};
+    int m_count{0};
+    QVector<TraceEvent> m_events;
+
+    QElapsedTimer m_clock;
+
+    QStringList m_debugCategories;
+
+    //! (viewId, span) -> start timestamp
+    QHash<QPair<int, QString>, qint64> m_activeSpans;
+    //! span -> latency samples in microseconds
+    QHash<QString, QVector<qint64>> m_spanSamples;
+};
+
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "badgesqueue.h"
+
+// Qt
+#include <QTest>
+
+using namespace Latte::ViewPart;
+
+//! timers are allowed to fire a bit late under load
+static const int TIMERTOLERANCE = 100;
+
+class BadgesQueueTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void lastValueWins();
+    void burstRequestsOneDelivery();
+    void takeEmptiesQueue();
+    void undeliveredBadgesAreRequestedAgain();
+    void emptyQueueRequestsNothing();
+    void clearDropsPendingDelivery();
+
+    void benchmarkChattyApplications();
+
+private:
+    BadgesQueue *m_queue{nullptr};
+
+    int m_requests{0};
+    //! badges taken on each delivery request, empty when the receiver was missing
+    QList<QHash<QString, QString>> m_deliveries;
+    bool m_receiverIsAvailable{true};
+};
+
+void BadgesQueueTest::init()
+{
+    m_requests = 0;
+    m_deliveries.clear();
+    m_receiverIsAvailable = true;
+
+    m_queue = new BadgesQueue(this);
+
+    //! delivers like ContainmentInterface, badges are taken only when they can be delivered
+    connect(m_queue, &BadgesQueue::deliveryRequested, this, [&]() {
+        m_requests++;
+
+        if (m_receiverIsAvailable) {
+            m_deliveries << m_queue->take();
+        }
+    });
+}
+
+void BadgesQueueTest::cleanup()
+{
+    delete m_queue;
+    m_queue = nullptr;
+}
+
+void BadgesQueueTest::lastValueWins()
+{
+    m_queue->enqueue("applications:org.kde.konversation.desktop", "1");
+    m_queue->enqueue("applications:org.kde.konversation.desktop", "2");
+    m_queue->enqueue("applications:org.kde.kmail2.desktop", "7");
+    m_queue->enqueue("applications:org.kde.konversation.desktop", "3");
+
+    QCOMPARE(m_queue->count(), 2);
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_deliveries.count(), 1, BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+
+    QHash<QString, QString> expected;
+    expected["applications:org.kde.konversation.desktop"] = "3";
+    expected["applications:org.kde.kmail2.desktop"] = "7";
+    QCOMPARE(m_deliveries[0], expected);
+}
+
+void BadgesQueueTest::burstRequestsOneDelivery()
+{
+    for (int i=0; i<1000; ++i) {
+        m_queue->enqueue(QString("app%1").arg(i % 10), QString::number(i));
+    }
+
+    QCOMPARE(m_requests, 0);
+    QTRY_COMPARE_WITH_TIMEOUT(m_requests, 1, BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+
+    QTest::qWait(BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_requests, 1);
+    QCOMPARE(m_deliveries[0].count(), 10);
+    QCOMPARE(m_deliveries[0]["app9"], QString("999"));
+}
+
+void BadgesQueueTest::takeEmptiesQueue()
+{
+    m_queue->enqueue("app", "1");
+    QVERIFY(!m_queue->isEmpty());
+
+    QHash<QString, QString> badges = m_queue->take();
+    QCOMPARE(badges.count(), 1);
+    QVERIFY(m_queue->isEmpty());
+    QVERIFY(m_queue->take().isEmpty());
+}
+
+void BadgesQueueTest::undeliveredBadgesAreRequestedAgain()
+{
+    m_receiverIsAvailable = false;
+
+    m_queue->enqueue("app1", "1");
+    m_queue->enqueue("app2", "2");
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_requests, 1, BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_deliveries.count(), 0);
+
+    //! nothing is requested again until something changes
+    QTest::qWait(BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_requests, 1);
+    QCOMPARE(m_queue->count(), 2);
+
+    //! e.g. Latte Tasks finished loading, newer values still replace the kept ones
+    m_queue->enqueue("app1", "5");
+    m_receiverIsAvailable = true;
+    m_queue->scheduleDelivery();
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_deliveries.count(), 1, BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_requests, 2);
+    QCOMPARE(m_deliveries[0]["app1"], QString("5"));
+    QCOMPARE(m_deliveries[0]["app2"], QString("2"));
+    QVERIFY(m_queue->isEmpty());
+}
+
+void BadgesQueueTest::emptyQueueRequestsNothing()
+{
+    m_queue->scheduleDelivery();
+
+    QTest::qWait(BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_requests, 0);
+}
+
+void BadgesQueueTest::clearDropsPendingDelivery()
+{
+    m_queue->enqueue("app1", "1");
+    m_queue->clear();
+
+    QVERIFY(m_queue->isEmpty());
+    QTest::qWait(BadgesQueue::DELIVERYINTERVAL + TIMERTOLERANCE);
+    QCOMPARE(m_requests, 0);
+}
+
+void BadgesQueueTest::benchmarkChattyApplications()
+{
+    //! a few applications that update their badges continuously
+    QBENCHMARK {
+        for (int i=0; i<10000; ++i) {
+            m_queue->enqueue(QString("app%1").arg(i % 20), QString::number(i));
+        }
+
+        m_queue->take();
+    }
+}
+
+QTEST_GUILESS_MAIN(BadgesQueueTest)
+
+#include "badgesqueuetest.moc"
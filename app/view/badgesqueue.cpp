@@ -0,0 +1,58 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "badgesqueue.h"
+
+namespace Latte {
+namespace ViewPart {
+
+BadgesQueue::BadgesQueue(QObject *parent)
+    : QObject(parent)
+{
+    m_deliveryTimer.setInterval(DELIVERYINTERVAL);
+    m_deliveryTimer.setSingleShot(true);
+    connect(&m_deliveryTimer, &QTimer::timeout, this, &BadgesQueue::deliveryRequested);
+}
+
+bool BadgesQueue::isEmpty() const
+{
+    return m_badges.isEmpty();
+}
+
+int BadgesQueue::count() const
+{
+    return m_badges.count();
+}
+
+void BadgesQueue::enqueue(const QString &identifier, const QString &value)
+{
+    m_badges[identifier] = value;
+    scheduleDelivery();
+}
+
+QHash<QString, QString> BadgesQueue::take()
+{
+    QHash<QString, QString> badges;
+    badges.swap(m_badges);
+    return badges;
+}
+
+void BadgesQueue::clear()
+{
+    m_badges.clear();
+    m_deliveryTimer.stop();
+}
+
+void BadgesQueue::scheduleDelivery()
+{
+    if (m_badges.isEmpty() || m_deliveryTimer.isActive()) {
+        return;
+    }
+
+    m_deliveryTimer.start();
+}
+
+}
+}
@@ -0,0 +1,54 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef VIEWBADGESQUEUE_H
+#define VIEWBADGESQUEUE_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+namespace Latte {
+namespace ViewPart {
+
+//! Badges of external applications are queued per identifier and only the last value of
+//! each identifier is kept, because chatty apps send many updates per second. Delivery is
+//! requested at most once per frame and badges stay queued until they are taken, so
+//! badges that can not be delivered yet are requested again later
+class BadgesQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int DELIVERYINTERVAL = 16;
+
+    BadgesQueue(QObject *parent = nullptr);
+
+    bool isEmpty() const;
+    int count() const;
+
+    void enqueue(const QString &identifier, const QString &value);
+    //! identifier, value of all queued badges, the queue becomes empty
+    QHash<QString, QString> take();
+    void clear();
+
+public slots:
+    //! e.g. when the receiver of the queued badges may have appeared
+    void scheduleDelivery();
+
+signals:
+    void deliveryRequested();
+
+private:
+    QHash<QString, QString> m_badges;
+    QTimer m_deliveryTimer;
+};
+
+}
+}
+
+#endif
@@ -50,10 +50,14 @@ ContainmentInterface::ContainmentInterface(Latte::View *parent)
 
     connect(&m_appletsExpandedConnectionsTimer, &QTimer::timeout, this, &ContainmentInterface::updateAppletsTracking);
 
+    connect(&m_pendingBadges, &BadgesQueue::deliveryRequested, this, &ContainmentInterface::deliverPendingBadges);
+
     connect(m_view, &View::containmentChanged
             , this, [&]() {
         if (m_view->containment()) {
             connect(m_view->containment(), &Plasma::Containment::appletAdded, this, &ContainmentInterface::onAppletAdded);
+            //! badges that found no Latte Tasks item are retried when applets change
+            connect(m_view->containment(), &Plasma::Containment::appletAdded, &m_pendingBadges, &BadgesQueue::scheduleDelivery);
             m_appletsExpandedConnectionsTimer.start();
         }
     });
@@ -200,45 +204,69 @@ bool ContainmentInterface::updateBadgeForLatteTask(const QString identifier, con
         return false;
     }
 
+    m_pendingBadges.enqueue(identifier, value);
+
+    return true;
+}
+
+void ContainmentInterface::identifyBadgesHost()
+{
+    if (m_badgesHost || !m_view->containment()) {
+        return;
+    }
+
     const auto &applets = m_view->containment()->applets();
 
     for (auto *applet : applets) {
         KPluginMetaData meta = applet->kPackage().metadata();
 
-        if (meta.pluginId() == QLatin1String("org.kde.latte.plasmoid")) {
-
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
+        if (meta.pluginId() != QLatin1String("org.kde.latte.plasmoid")) {
+            continue;
+        }
 
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        // not using QMetaObject::invokeMethod to avoid warnings when calling
-                        // this on applets that don't have it or other child items since this
-                        // is pretty much trial and error.
-                        // Also, "var" arguments are treated as QVariant in QMetaObject
+        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
+            const auto &childItems = appletInterface->childItems();
 
-                        int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
+            for (QQuickItem *item : childItems) {
+                if (auto *metaObject = item->metaObject()) {
+                    // not using QMetaObject::invokeMethod to avoid warnings when calling
+                    // this on applets that don't have it or other child items since this
+                    // is pretty much trial and error.
+                    // Also, "var" arguments are treated as QVariant in QMetaObject
 
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+                    int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
 
-                        QMetaMethod method = metaObject->method(methodIndex);
-
-                        if (method.invoke(item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
-                            return true;
-                        }
+                    if (methodIndex == -1) {
+                        continue;
                     }
+
+                    m_badgesHost = item;
+                    m_updateBadgeMethod = metaObject->method(methodIndex);
+                    return;
                 }
             }
         }
     }
+}
 
-    return false;
+void ContainmentInterface::deliverPendingBadges()
+{
+    if (m_pendingBadges.isEmpty()) {
+        return;
+    }
+
+    identifyBadgesHost();
+
+    if (!m_badgesHost) {
+        //! e.g. Latte Tasks is still loading, badges are kept until applets change
+        return;
+    }
+
+    const QHash<QString, QString> badges = m_pendingBadges.take();
+
+    for (auto it = badges.constBegin(); it != badges.constEnd(); ++it) {
+        m_updateBadgeMethod.invoke(m_badgesHost, Q_ARG(QVariant, it.key()), Q_ARG(QVariant, it.value()));
+    }
 }
 
 bool ContainmentInterface::activatePlasmaTask(const int index)
@@ -773,6 +801,14 @@ void ContainmentInterface::onLatteTasksCountChanged()
     }
 
     m_hasLatteTasks = (m_latteTasksModel->count() > 0);
+
+    if (m_hasLatteTasks) {
+        m_pendingBadges.scheduleDelivery();
+    } else {
+        //! there is nothing to deliver them to anymore
+        m_pendingBadges.clear();
+    }
+
     emit hasLatteTasksChanged();
 }
 
@@ -7,6 +7,7 @@
 #define VIEWCONTAINMENTINTERFACE_H
 
 // local
+#include "badgesqueue.h"
 #include "tasksmodel.h"
 
 // Qt
@@ -86,7 +87,8 @@ public:
     bool showOnlyMeta();
     bool showShortcutBadges(const bool showLatteShortcuts, const bool showMeta);
 
-    //! this is updated from external apps e.g. a thunderbird plugin
+    //! this is updated from external apps e.g. a thunderbird plugin,
+    //! updates are queued and delivered together at most once per frame
     bool updateBadgeForLatteTask(const QString identifier, const QString value);
 
     int applicationLauncherId() const;
@@ -155,6 +157,9 @@ signals:
 private slots:
     void identifyShortcutsHost();
     void identifyMethods();
+    void identifyBadgesHost();
+
+    void deliverPendingBadges();
 
     void updateAppletsOrder();
     void updateAppletsInLockedZoom();
@@ -186,10 +191,13 @@ private:
     QMetaMethod m_appletIdForIndexMethod;
     QMetaMethod m_newInstanceMethod;
     QMetaMethod m_showShortcutsMethod;
+    QMetaMethod m_updateBadgeMethod;
 
     QPointer<Latte::Corona> m_corona;
     QPointer<Latte::View> m_view;
     QPointer<QQuickItem> m_shortcutsHost;
+    //! Latte Tasks item that badges are delivered to
+    QPointer<QQuickItem> m_badgesHost;
 
     //! startup timer to initialize
     //! applets tracking
@@ -213,6 +221,9 @@ private:
     QList<int> m_appletsDisabledColoring;
     QHash<int, ViewPart::AppletInterfaceData> m_appletData;
     QTimer m_appletDelayedConfigurationTimer;
+
+    //! badges that are not delivered yet, they wait until a Latte Tasks item can receive them
+    BadgesQueue m_pendingBadges;
 };
 
 }
@@ -8,9 +8,14 @@
 // local
 #include "../view.h"
 #include "../positioner.h"
+#include "../visibilitymanager.h"
+#include "../../wm/abstractwindowinterface.h"
 
 // Qt
 #include <QDebug>
+#include <QDropEvent>
+#include <QEnterEvent>
+#include <QMouseEvent>
 #include <QSurfaceFormat>
 #include <QQuickView>
 #include <QTimer>
@@ -42,21 +47,13 @@ ScreenEdgeGhostWindow::ScreenEdgeGhostWindow(Latte::View *view) :
 
     setColor(m_showColor);
 
-    connect(m_latteView->positioner(), &Latte::ViewPart::Positioner::slideOffsetChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
-
     //! this timer is used in order to avoid fast enter/exit signals during first
     //! appearing after edge activation
     m_delayedMouseTimer.setSingleShot(true);
     m_delayedMouseTimer.setInterval(50);
-    connect(&m_delayedMouseTimer, &QTimer::timeout, this, [this]() {
-        if (m_delayedContainsMouse) {
-            setContainsMouse(true);
-        } else {
-            setContainsMouse(false);
-        }
-    });
+    connect(&m_delayedMouseTimer, &QTimer::timeout, this, &ScreenEdgeGhostWindow::updateContainsMouse);
 
-    updateGeometry();
+    addView(view);
     hideWithMask();
 }
 
@@ -69,13 +66,100 @@ QString ScreenEdgeGhostWindow::validTitlePrefix() const
     return QString("#subghostedge#");
 }
 
-void ScreenEdgeGhostWindow::updateGeometry()
+QList<Latte::View *> ScreenEdgeGhostWindow::views() const
+{
+    return m_views;
+}
+
+void ScreenEdgeGhostWindow::addView(Latte::View *view)
+{
+    if (!view || m_views.contains(view)) {
+        return;
+    }
+
+    m_views << view;
+
+    //! host view geometry changes are already tracked by SubWindow
+    if (view != m_latteView) {
+        connect(view, &Latte::View::absoluteGeometryChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
+        connect(view, &Latte::View::screenGeometryChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
+    }
+
+    connect(view->positioner(), &Latte::ViewPart::Positioner::slideOffsetChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
+
+    updateGeometry();
+}
+
+void ScreenEdgeGhostWindow::removeView(Latte::View *view)
+{
+    //! the host view can not be removed, the window must be recreated for another host
+    if (!m_views.contains(view) || view == m_latteView) {
+        return;
+    }
+
+    disconnect(view, nullptr, this, nullptr);
+    disconnect(view->positioner(), nullptr, this, nullptr);
+
+    m_views.removeAll(view);
+    m_activeViews.removeAll(view);
+    m_viewsContainingMouse.removeAll(view);
+    m_triggerGeometries.remove(view);
+
+    updateGeometry();
+    m_corona->wm()->setActiveEdge(this, !m_activeViews.isEmpty());
+    updateMask();
+}
+
+bool ScreenEdgeGhostWindow::isActive(Latte::View *view) const
 {
-    if (m_latteView->positioner()->slideOffset() != 0) {
+    return m_activeViews.contains(view);
+}
+
+void ScreenEdgeGhostWindow::setViewActive(Latte::View *view, bool active)
+{
+    if (!m_views.contains(view)) {
         return;
     }
 
-    QRect newGeometry = m_latteView->absoluteGeometry();
+    bool activeViewsChanged{false};
+
+    if (active && !m_activeViews.contains(view)) {
+        m_activeViews << view;
+        activeViewsChanged = true;
+    } else if (!active && m_activeViews.contains(view)) {
+        m_activeViews.removeAll(view);
+        activeViewsChanged = true;
+    }
+
+    if (activeViewsChanged) {
+        //! the reserved screen edge must follow the active views only
+        updateGeometry();
+    }
+
+    //! always forwarded because KWin resets the edge after it has been triggered
+    m_corona->wm()->setActiveEdge(this, !m_activeViews.isEmpty());
+    updateMask();
+}
+
+void ScreenEdgeGhostWindow::updateMask()
+{
+    //! the window manager interface shows and hides the window, only the unmasked area is adjusted
+    if (m_activeViews.isEmpty() || mask() == QRegion(VisibilityManager::ISHIDDENMASK)) {
+        return;
+    }
+
+    QRegion activeRegion;
+
+    for (const auto view : m_activeViews) {
+        activeRegion += localTriggerGeometry(view);
+    }
+
+    setMask(activeRegion);
+}
+
+QRect ScreenEdgeGhostWindow::triggerGeometry(Latte::View *view)
+{
+    QRect newGeometry = view->absoluteGeometry();
 
     if (KWindowSystem::compositingActive()) {
         m_thickness = 6;
@@ -86,77 +170,134 @@ void ScreenEdgeGhostWindow::updateGeometry()
     int length{30};
     int lengthDifference{0};
 
-    if (m_latteView->formFactor() == Plasma::Types::Horizontal) {
+    if (view->formFactor() == Plasma::Types::Horizontal) {
         //! set minimum length to be 25% of screen width
-        length = qMax(m_latteView->screenGeometry().width()/4,qMin(m_latteView->absoluteGeometry().width(), m_latteView->screenGeometry().width() - 1));
-        lengthDifference = qMax(0,length - m_latteView->absoluteGeometry().width()) / 2;
+        length = qMax(view->screenGeometry().width()/4,qMin(view->absoluteGeometry().width(), view->screenGeometry().width() - 1));
+        lengthDifference = qMax(0,length - view->absoluteGeometry().width()) / 2;
     } else {
         //! set minimum length to be 25% of screen height
-        length = qMax(m_latteView->screenGeometry().height()/4,qMin(m_latteView->absoluteGeometry().height(), m_latteView->screenGeometry().height() - 1));
-        lengthDifference = qMax(0,length - m_latteView->absoluteGeometry().height()) / 2;
+        length = qMax(view->screenGeometry().height()/4,qMin(view->absoluteGeometry().height(), view->screenGeometry().height() - 1));
+        lengthDifference = qMax(0,length - view->absoluteGeometry().height()) / 2;
     }
 
-    if (m_latteView->formFactor() == Plasma::Types::Horizontal) {
-        int leftF = qMax(m_latteView->screenGeometry().left(), m_latteView->absoluteGeometry().left() - lengthDifference);
-        int rightF = qMax(m_latteView->screenGeometry().left(), qMin(m_latteView->screenGeometry().right(), m_latteView->absoluteGeometry().right() + lengthDifference));
+    if (view->formFactor() == Plasma::Types::Horizontal) {
+        int leftF = qMax(view->screenGeometry().left(), view->absoluteGeometry().left() - lengthDifference);
+        int rightF = qMax(view->screenGeometry().left(), qMin(view->screenGeometry().right(), view->absoluteGeometry().right() + lengthDifference));
         newGeometry.setLeft(leftF);
         newGeometry.setRight(rightF);
     } else {
-        int topF = qMax(m_latteView->screenGeometry().top(), m_latteView->absoluteGeometry().top() - lengthDifference);
-        int bottomF = qMax(m_latteView->screenGeometry().top(), qMin(m_latteView->screenGeometry().bottom(), m_latteView->absoluteGeometry().bottom() + lengthDifference));
+        int topF = qMax(view->screenGeometry().top(), view->absoluteGeometry().top() - lengthDifference);
+        int bottomF = qMax(view->screenGeometry().top(), qMin(view->screenGeometry().bottom(), view->absoluteGeometry().bottom() + lengthDifference));
         newGeometry.setTop(topF);
         newGeometry.setBottom(bottomF);
     }
 
-    if (m_latteView->location() == Plasma::Types::BottomEdge) {
-        newGeometry.moveTop(m_latteView->screenGeometry().bottom() - m_thickness);
-    } else if (m_latteView->location() == Plasma::Types::TopEdge) {
-        newGeometry.moveTop(m_latteView->screenGeometry().top());
-    } else if (m_latteView->location() == Plasma::Types::LeftEdge) {
-        newGeometry.moveLeft(m_latteView->screenGeometry().left());
-    } else if (m_latteView->location() == Plasma::Types::RightEdge) {        
-        newGeometry.moveLeft(m_latteView->screenGeometry().right() - m_thickness);
+    if (view->location() == Plasma::Types::BottomEdge) {
+        newGeometry.moveTop(view->screenGeometry().bottom() - m_thickness);
+    } else if (view->location() == Plasma::Types::TopEdge) {
+        newGeometry.moveTop(view->screenGeometry().top());
+    } else if (view->location() == Plasma::Types::LeftEdge) {
+        newGeometry.moveLeft(view->screenGeometry().left());
+    } else if (view->location() == Plasma::Types::RightEdge) {
+        newGeometry.moveLeft(view->screenGeometry().right() - m_thickness);
     }
 
-    if (m_latteView->formFactor() == Plasma::Types::Horizontal) {
+    if (view->formFactor() == Plasma::Types::Horizontal) {
         newGeometry.setHeight(m_thickness + 1);
     } else {
         newGeometry.setWidth(m_thickness + 1);
     }
 
+    return newGeometry;
+}
+
+QRect ScreenEdgeGhostWindow::localTriggerGeometry(Latte::View *view) const
+{
+    return m_triggerGeometries.value(view).translated(-m_calculatedGeometry.topLeft());
+}
+
+void ScreenEdgeGhostWindow::updateGeometry()
+{
+    QRect newGeometry;
+
+    for (const auto view : m_views) {
+        //! views that are sliding keep their last trigger area
+        if (view->positioner()->slideOffset() == 0 || !m_triggerGeometries.contains(view)) {
+            m_triggerGeometries[view] = triggerGeometry(view);
+        }
+    }
+
+    //! KWin reserves the screen edge for the whole window, so while views are active the
+    //! window covers only their trigger areas and visible views keep their edge untouched
+    const QList<Latte::View *> &coveredViews = m_activeViews.isEmpty() ? m_views : m_activeViews;
+
+    for (const auto view : coveredViews) {
+        newGeometry = newGeometry.united(m_triggerGeometries[view]);
+    }
+
+    if (newGeometry.isEmpty()) {
+        return;
+    }
+
     m_calculatedGeometry = newGeometry;
     emit calculatedGeometryChanged();
+
+    updateMask();
 }
 
-bool ScreenEdgeGhostWindow::containsMouse() const
+bool ScreenEdgeGhostWindow::containsMouse(Latte::View *view) const
 {
-    return m_containsMouse;
+    return m_viewsContainingMouse.contains(view);
 }
 
-void ScreenEdgeGhostWindow::setContainsMouse(bool contains)
+void ScreenEdgeGhostWindow::setContainsMouse(Latte::View *view, bool contains)
 {
-    if (m_containsMouse == contains) {
+    if (m_viewsContainingMouse.contains(view) == contains) {
         return;
     }
 
-    m_containsMouse = contains;
-    emit containsMouseChanged(contains);
+    if (contains) {
+        m_viewsContainingMouse << view;
+    } else {
+        m_viewsContainingMouse.removeAll(view);
+    }
+
+    emit containsMouseChanged(view, contains);
+}
+
+void ScreenEdgeGhostWindow::updateContainsMouse()
+{
+    for (const auto view : m_views) {
+        setContainsMouse(view, m_delayedContainsMouse && localTriggerGeometry(view).contains(m_mousePosition));
+    }
 }
 
 bool ScreenEdgeGhostWindow::event(QEvent *e)
 {
     if (e->type() == QEvent::DragEnter || e->type() == QEvent::DragMove) {
-        if (!m_containsMouse) {
-            m_delayedContainsMouse = false;
-            m_delayedMouseTimer.stop();
-            setContainsMouse(true);
-            emit dragEntered();
+        m_mousePosition = static_cast<QDropEvent *>(e)->pos();
+
+        for (const auto view : m_views) {
+            if (!containsMouse(view) && localTriggerGeometry(view).contains(m_mousePosition)) {
+                m_delayedContainsMouse = false;
+                m_delayedMouseTimer.stop();
+                setContainsMouse(view, true);
+                emit dragEntered(view);
+            }
         }
     } else if (e->type() == QEvent::Enter) {
+        m_mousePosition = static_cast<QEnterEvent *>(e)->pos();
         m_delayedContainsMouse = true;
         if (!m_delayedMouseTimer.isActive()) {
             m_delayedMouseTimer.start();
         }
+    } else if (e->type() == QEvent::MouseMove) {
+        m_mousePosition = static_cast<QMouseEvent *>(e)->pos();
+
+        //! the mouse moved along the edge from one view trigger area to another
+        if (m_delayedContainsMouse && !m_delayedMouseTimer.isActive()) {
+            updateContainsMouse();
+        }
     } else if (e->type() == QEvent::Leave || e->type() == QEvent::DragLeave) {
         m_delayedContainsMouse = false;
         if (!m_delayedMouseTimer.isActive()) {
@@ -12,6 +12,8 @@
 #include "../../wm/windowinfowrap.h"
 
 // Qt
+#include <QHash>
+#include <QList>
 #include <QObject>
 #include <QQuickView>
 #include <QTimer>
@@ -46,6 +48,11 @@ namespace ViewPart {
 //!
 //! KDE BUGS: https://bugs.kde.org/show_bug.cgi?id=382219
 //!           https://bugs.kde.org/show_bug.cgi?id=392464
+//!
+//! Under X11 a single window is shared by all views that are placed at the same screen
+//! edge, it is managed by ScreenEdgeTriggers. The first view is the host that the window
+//! is created for, the window geometry covers the trigger areas of the active views and
+//! only these areas are unmasked.
 
 class ScreenEdgeGhostWindow : public SubWindow
 {
@@ -55,11 +62,18 @@ public:
     ScreenEdgeGhostWindow(Latte::View *view);
     ~ScreenEdgeGhostWindow() override;
 
-    bool containsMouse() const;
+    bool containsMouse(Latte::View *view) const;
+    bool isActive(Latte::View *view) const;
+
+    QList<Latte::View *> views() const;
+
+    void addView(Latte::View *view);
+    void removeView(Latte::View *view);
+    void setViewActive(Latte::View *view, bool active);
 
 signals:
-    void containsMouseChanged(bool contains);
-    void dragEntered();
+    void containsMouseChanged(Latte::View *view, bool contains);
+    void dragEntered(Latte::View *view);
 
 protected:
     bool event(QEvent *ev) override;
@@ -67,11 +81,25 @@ protected:
     void updateGeometry() override;
 
 private:
-    void setContainsMouse(bool contains);
+    void setContainsMouse(Latte::View *view, bool contains);
+    void updateContainsMouse();
+    void updateMask();
+
+    //! trigger area of the view in screen coordinates
+    QRect triggerGeometry(Latte::View *view);
+    //! trigger area of the view in window coordinates
+    QRect localTriggerGeometry(Latte::View *view) const;
 
 private:
     bool m_delayedContainsMouse{false};
-    bool m_containsMouse{false};
+
+    QPoint m_mousePosition;
+
+    QList<Latte::View *> m_views;
+    QList<Latte::View *> m_activeViews;
+    QList<Latte::View *> m_viewsContainingMouse;
+
+    QHash<Latte::View *, QRect> m_triggerGeometries;
 
     QTimer m_delayedMouseTimer;
 };
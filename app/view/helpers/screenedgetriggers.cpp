@@ -0,0 +1,183 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "screenedgetriggers.h"
+
+// local
+#include "screenedgeghostwindow.h"
+#include "../view.h"
+#include "../../lattecorona.h"
+
+// Qt
+#include <QScreen>
+
+// KDE
+#include <KWindowSystem>
+
+// Plasma
+#include <Plasma/Containment>
+
+namespace Latte {
+namespace ViewPart {
+
+ScreenEdgeTriggers::ScreenEdgeTriggers(Latte::Corona *corona)
+    : QObject(corona),
+      m_corona(corona)
+{
+}
+
+ScreenEdgeTriggers::~ScreenEdgeTriggers()
+{
+    for (const auto window : m_windows) {
+        window->deleteLater();
+    }
+
+    m_windows.clear();
+}
+
+QString ScreenEdgeTriggers::edgeId(Latte::View *view) const
+{
+    QString screenName = view->screen() ? view->screen()->name() : QString();
+    QString id = screenName + "::" + QString::number((int)view->location());
+
+    if (KWindowSystem::isPlatformWayland()) {
+        //! auto hiding panel requests are applied per surface and they depend on
+        //! the host view visibility mode, so each view keeps its own window
+        id += "::" + QString::number(view->containment()->id());
+    }
+
+    return id;
+}
+
+ScreenEdgeGhostWindow *ScreenEdgeTriggers::windowForView(Latte::View *view) const
+{
+    if (!m_viewEdges.contains(view)) {
+        return nullptr;
+    }
+
+    return m_windows.value(m_viewEdges[view], nullptr);
+}
+
+bool ScreenEdgeTriggers::hasView(Latte::View *view) const
+{
+    return m_viewEdges.contains(view);
+}
+
+bool ScreenEdgeTriggers::containsMouse(Latte::View *view) const
+{
+    ScreenEdgeGhostWindow *window = windowForView(view);
+    return window && window->containsMouse(view);
+}
+
+ScreenEdgeGhostWindow *ScreenEdgeTriggers::createWindow(Latte::View *host)
+{
+    ScreenEdgeGhostWindow *window = new ScreenEdgeGhostWindow(host);
+
+    connect(window, &ScreenEdgeGhostWindow::containsMouseChanged, this, &ScreenEdgeTriggers::containsMouseChanged);
+    connect(window, &ScreenEdgeGhostWindow::dragEntered, this, &ScreenEdgeTriggers::dragEntered);
+
+    m_windows[edgeId(host)] = window;
+
+    return window;
+}
+
+void ScreenEdgeTriggers::addView(Latte::View *view)
+{
+    if (!view || m_viewEdges.contains(view)) {
+        return;
+    }
+
+    QString edge = edgeId(view);
+    m_viewEdges[view] = edge;
+
+    if (m_windows.contains(edge)) {
+        m_windows[edge]->addView(view);
+    } else {
+        createWindow(view);
+    }
+
+    connect(view, &Latte::View::locationChanged, this, &ScreenEdgeTriggers::onViewEdgeChanged);
+    connect(view, &QQuickView::screenChanged, this, &ScreenEdgeTriggers::onViewEdgeChanged);
+}
+
+void ScreenEdgeTriggers::removeView(Latte::View *view)
+{
+    if (!m_viewEdges.contains(view)) {
+        return;
+    }
+
+    disconnect(view, nullptr, this, nullptr);
+
+    QString edge = m_viewEdges.take(view);
+    ScreenEdgeGhostWindow *window = m_windows.value(edge, nullptr);
+
+    if (!window) {
+        return;
+    }
+
+    if (window->parentView() != view) {
+        window->removeView(view);
+        return;
+    }
+
+    //! the window was created for this view, it is recreated for the remaining views
+    QList<Latte::View *> remainingViews = window->views();
+    remainingViews.removeAll(view);
+
+    QList<Latte::View *> activeViews;
+
+    for (const auto remaining : remainingViews) {
+        if (window->isActive(remaining)) {
+            activeViews << remaining;
+        }
+    }
+
+    m_windows.remove(edge);
+    disconnect(window, nullptr, this, nullptr);
+    window->deleteLater();
+
+    if (remainingViews.isEmpty()) {
+        return;
+    }
+
+    ScreenEdgeGhostWindow *newWindow = createWindow(remainingViews.takeFirst());
+
+    for (const auto remaining : remainingViews) {
+        newWindow->addView(remaining);
+    }
+
+    for (const auto active : activeViews) {
+        newWindow->setViewActive(active, true);
+    }
+}
+
+void ScreenEdgeTriggers::setViewActive(Latte::View *view, bool active)
+{
+    if (ScreenEdgeGhostWindow *window = windowForView(view)) {
+        window->setViewActive(view, active);
+    }
+}
+
+void ScreenEdgeTriggers::onViewEdgeChanged()
+{
+    Latte::View *view = qobject_cast<Latte::View *>(sender());
+
+    if (!view || !m_viewEdges.contains(view) || m_viewEdges[view] == edgeId(view)) {
+        return;
+    }
+
+    ScreenEdgeGhostWindow *window = windowForView(view);
+    bool active = window && window->isActive(view);
+
+    removeView(view);
+    addView(view);
+
+    if (active) {
+        setViewActive(view, true);
+    }
+}
+
+}
+}
@@ -0,0 +1,72 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef SCREENEDGETRIGGERS_H
+#define SCREENEDGETRIGGERS_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+
+namespace Latte {
+class Corona;
+class View;
+namespace ViewPart {
+class ScreenEdgeGhostWindow;
+}
+}
+
+namespace Latte {
+namespace ViewPart {
+
+//! Views that activate the screen edge in order to reappear are grouped by
+//! screen and edge under X11. Each group shares one ScreenEdgeGhostWindow instead of
+//! creating a window with its own scenegraph for every view, mouse and drag
+//! events of the shared window are dispatched to the views whose trigger
+//! area contains them.
+
+class ScreenEdgeTriggers : public QObject
+{
+    Q_OBJECT
+
+public:
+    ScreenEdgeTriggers(Latte::Corona *corona);
+    ~ScreenEdgeTriggers() override;
+
+    bool hasView(Latte::View *view) const;
+    bool containsMouse(Latte::View *view) const;
+
+    void addView(Latte::View *view);
+    void removeView(Latte::View *view);
+    void setViewActive(Latte::View *view, bool active);
+
+signals:
+    void containsMouseChanged(Latte::View *view, bool contains);
+    void dragEntered(Latte::View *view);
+
+private slots:
+    void onViewEdgeChanged();
+
+private:
+    QString edgeId(Latte::View *view) const;
+
+    ScreenEdgeGhostWindow *createWindow(Latte::View *host);
+    ScreenEdgeGhostWindow *windowForView(Latte::View *view) const;
+
+private:
+    QPointer<Latte::Corona> m_corona;
+
+    //! view, screen edge id
+    QHash<Latte::View *, QString> m_viewEdges;
+    //! screen edge id, shared window
+    QHash<QString, ScreenEdgeGhostWindow *> m_windows;
+};
+
+}
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include "../layout/centrallayout.h"
 #include "../layouts/manager.h"
 #include "../settings/universalsettings.h"
+#include "../tools/tracer.h"
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
@@ -881,6 +882,11 @@ void Positioner::setSlideOffset(int offset)
     }
 
     m_slideOffset = offset;
+
+    if (Tracer::self()->isEnabled()) {
+        Tracer::self()->record(m_view->containment() ? (int)m_view->containment()->id() : -1, "positioner", QString("slide offset %1").arg(offset));
+    }
+
     emit slideOffsetChanged();
 }
 
@@ -1084,6 +1090,11 @@ void Positioner::setInSlideAnimation(bool active)
     }
 
     m_inSlideAnimation = active;
+
+    if (Tracer::self()->isEnabled()) {
+        Tracer::self()->record(m_view->containment() ? (int)m_view->containment()->id() : -1, "positioner", QString("slide animation %1").arg(active ? "started" : "finished"));
+    }
+
     emit inSlideAnimationChanged();
 }
 
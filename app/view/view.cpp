@@ -159,6 +159,16 @@ View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassX11WM)
             connect(m_visibility, &ViewPart::VisibilityManager::containsMouseChanged,
                     this, &View::updateTransientWindowsTracking);
 
+            connect(m_visibility, &ViewPart::VisibilityManager::isSuspendedChanged, this, [&]() {
+                if (m_visibility->isSuspended()) {
+                    //! nothing is shown, scenegraph caches are rebuilt when the view is revealed
+                    releaseResources();
+                } else {
+                    //! prepare the first frame while the reveal animation is starting
+                    update();
+                }
+            });
+
             //! Deprecated because with Plasma 5.19.3 the issue does not appear.
             //! The issue was that when FrameExtents where zero strange behaviors were
             //! occuring from KWin, e.g. the panels were moving outside of screen and
@@ -210,6 +220,11 @@ View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassX11WM)
 
     if (m_corona) {
         connect(m_corona, &Latte::Corona::viewLocationChanged, this, &View::dockLocationChanged);
+
+        //! the first rendered frame of any view triggers the deferred startup initialization
+        if (!m_corona->deferredInitializationFinished()) {
+            connect(this, &QQuickWindow::frameSwapped, m_corona, &Latte::Corona::onViewFrameSwapped, Qt::QueuedConnection);
+        }
     }
 }
 
@@ -371,6 +386,10 @@ void View::init(Plasma::Containment *plasma_containment)
         emit indicatorPluginChanged(indicatorId);
     });
 
+    connect(m_corona->indicatorFactory(), &Latte::Indicator::Factory::indicatorAdded, this, [&](const QString &indicatorId) {
+        emit indicatorPluginChanged(indicatorId);
+    });
+
     connect(this, &View::indicatorPluginChanged, this, [&](const QString &indicatorId) {
         if (m_indicator && m_indicator->isCustomIndicator() && m_indicator->type() == indicatorId) {
             reloadSource();
@@ -11,16 +11,18 @@
 #include "positioner.h"
 #include "view.h"
 #include "helpers/floatinggapwindow.h"
-#include "helpers/screenedgeghostwindow.h"
+#include "helpers/screenedgetriggers.h"
 #include "windowstracker/currentscreentracker.h"
 #include "../apptypes.h"
 #include "../lattecorona.h"
 #include "../screenpool.h"
 #include "../layouts/manager.h"
+#include "../tools/tracer.h"
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
 #include <QDebug>
+#include <QGuiApplication>
 
 // KDE
 #include <KWindowSystem>
@@ -38,6 +40,10 @@ const int HIDEMINIMUMINTERVAL = 0;
 //! or global shortcuts we make sure bar will be shown enough time
 //! in order for the user to observe its contents
 const int SIDEBARAUTOHIDEMINIMUMSHOW = 1000;
+//! How much time a view must stay hidden before it is suspended
+const int SUSPENDINTERVAL = 3000;
+//! Resuming a view must not delay its reveal for more than one frame
+const int RESUMELATENCYBUDGET = 16;
 
 
 namespace Latte {
@@ -114,34 +120,63 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
         publishFrameExtents(forceUpdate);
     }
 
-    m_timerShow.setSingleShot(true);
-    m_timerHide.setSingleShot(true);
+    m_timerTransition.setSingleShot(true);
+    connect(&m_timerTransition, &QTimer::timeout, this, &VisibilityManager::onTransitionDeadline);
 
-    connect(&m_timerShow, &QTimer::timeout, this, [&]() {
-        if (m_isHidden ||  m_isBelowLayer) {
-            //   qDebug() << "must be shown";
-            emit mustBeShown();
+    //! Suspension, it is connected before any qml handler in order to resume the view
+    //! before its reveal animation starts
+    m_timerSuspend.setInterval(SUSPENDINTERVAL);
+    m_timerSuspend.setSingleShot(true);
+    connect(&m_timerSuspend, &QTimer::timeout, this, [&]() {
+        if (canBeSuspended()) {
+            setIsSuspended(true);
         }
     });
-    connect(&m_timerHide, &QTimer::timeout, this, [&]() {
-        if (!hidingIsBlocked() && !m_isHidden && !m_isBelowLayer && !m_dragEnter) {
-            if (m_isFloatingGapWindowEnabled) {
-                //! first check if mouse is inside the floating gap
-                checkMouseInFloatingArea();
-            } else {
-                //! immediate call
-                emit mustBeHide();
-            }
-        }
+
+    connect(this, &VisibilityManager::mustBeShown, this, [&]() {
+        setIsSuspended(false);
+        //! suspend again if the reveal did not happen after all
+        m_timerSuspend.start();
     });
+    connect(this, &VisibilityManager::isHiddenChanged, this, &VisibilityManager::updateSuspendedState);
+    connect(this, &VisibilityManager::containsMouseChanged, this, &VisibilityManager::updateSuspendedState);
+    connect(m_latteView, &Latte::View::inEditModeChanged, this, &VisibilityManager::updateSuspendedState);
+
+    //! Trace
+    m_traceIsEnabled = Tracer::self()->isEnabled();
+
+    if (m_traceIsEnabled) {
+        connect(this, &VisibilityManager::mustBeShown, this, [&]() {
+            Tracer::self()->cancelSpan(traceViewId(), "hide");
+            Tracer::self()->beginSpan(traceViewId(), "show", "request");
+            traceTransition("must be shown");
+        });
+
+        connect(this, &VisibilityManager::mustBeHide, this, [&]() {
+            Tracer::self()->cancelSpan(traceViewId(), "show");
+            Tracer::self()->beginSpan(traceViewId(), "hide", "request");
+            traceTransition("must be hidden");
+        });
+
+        connect(this, &VisibilityManager::isShownFullyChanged, this, [&]() {
+            if (m_isShownFully) {
+                Tracer::self()->endSpan(traceViewId(), "show");
+            }
+        });
+
+        connect(this, &VisibilityManager::slideOutFinished, this, [&]() {
+            Tracer::self()->endSpan(traceViewId(), "hide");
+        });
+    }
 
     m_timerPublishFrameExtents.setInterval(1500);
     m_timerPublishFrameExtents.setSingleShot(true);
     connect(&m_timerPublishFrameExtents, &QTimer::timeout, this, [&]() { publishFrameExtents(); });
+    connect(this, &VisibilityManager::isHiddenChanged, this, &VisibilityManager::updateDeadlines);
 
     m_timerBlockStrutsUpdate.setInterval(1000);
     m_timerBlockStrutsUpdate.setSingleShot(true);
-    connect(&m_timerBlockStrutsUpdate, &QTimer::timeout, this, [&]() { updateStrutsBasedOnLayoutsAndActivities(); });
+    connect(&m_timerBlockStrutsUpdate, &QTimer::timeout, this, &VisibilityManager::onStrutsUpdateDeadline);
 
     restoreConfig();
 
@@ -159,8 +194,8 @@ VisibilityManager::~VisibilityManager()
     qDebug() << "VisibilityManager deleting...";
     m_wm->removeViewStruts(*m_latteView);
 
-    if (m_edgeGhostWindow) {
-        m_edgeGhostWindow->deleteLater();
+    if (m_edgeTriggers) {
+        m_edgeTriggers->removeView(m_latteView);
     }
 
     if (m_floatingGapWindow) {
@@ -237,10 +272,12 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
         m_wm->removeViewStruts(*m_latteView);
     }
 
-    m_timerShow.stop();
-    m_timerHide.stop();
+    //! a pending show is kept, it is delivered by updateDeadlines() or re-evaluated by the new mode
+    cancelTransition(PendingTransition::Hide);
     m_mode = mode;
 
+    updateDeadlines();
+
     initViewFlags();
 
     if (mode != Types::AlwaysVisible && mode != Types::WindowsGoBelow) {
@@ -301,32 +338,34 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
 
     case Types::DodgeActive: {
         m_connections[base] = connect(this, &VisibilityManager::containsMouseChanged
-                                      , this, &VisibilityManager::dodgeActive);
+                                      , this, &VisibilityManager::dodgeWindows);
         m_connections[base+1] = connect(m_latteView->windowsTracker()->currentScreen(), &TrackerPart::CurrentScreenTracker::activeWindowTouchingChanged
-                                        , this, &VisibilityManager::dodgeActive);
+                                        , this, &VisibilityManager::updateDodgeCondition);
 
-        dodgeActive();
+        updateDodgeCondition();
         break;
     }
 
     case Types::DodgeMaximized: {
         m_connections[base] = connect(this, &VisibilityManager::containsMouseChanged
-                                      , this, &VisibilityManager::dodgeMaximized);
+                                      , this, &VisibilityManager::dodgeWindows);
         m_connections[base+1] = connect(m_latteView->windowsTracker()->currentScreen(), &TrackerPart::CurrentScreenTracker::activeWindowMaximizedChanged
-                                        , this, &VisibilityManager::dodgeMaximized);
+                                        , this, &VisibilityManager::updateDodgeCondition);
 
-        dodgeMaximized();
+        updateDodgeCondition();
         break;
     }
 
     case Types::DodgeAllWindows: {
         m_connections[base] = connect(this, &VisibilityManager::containsMouseChanged
-                                      , this, &VisibilityManager::dodgeAllWindows);
+                                      , this, &VisibilityManager::dodgeWindows);
 
         m_connections[base+1] = connect(m_latteView->windowsTracker()->currentScreen(), &TrackerPart::CurrentScreenTracker::existsWindowTouchingChanged
-                                        , this, &VisibilityManager::dodgeAllWindows);
+                                        , this, &VisibilityManager::updateDodgeCondition);
+        m_connections[base+2] = connect(m_latteView->windowsTracker()->currentScreen(), &TrackerPart::CurrentScreenTracker::activeWindowTouchingChanged
+                                        , this, &VisibilityManager::updateDodgeCondition);
 
-        dodgeAllWindows();
+        updateDodgeCondition();
         break;
     }
 
@@ -376,16 +415,34 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
         break;
     }
 
+    traceTransition("mode changed");
+
     emit modeChanged();
 }
 
 void VisibilityManager::updateStrutsAfterTimer()
 {
+    if (!modeUsesDeadline(Deadline::Struts)) {
+        return;
+    }
+
     bool execute = !m_timerBlockStrutsUpdate.isActive();
 
     m_timerBlockStrutsUpdate.start();
 
     if (execute) {
+        m_strutsUpdateIsPending = false;
+        updateStrutsBasedOnLayoutsAndActivities();
+    } else {
+        m_strutsUpdateIsPending = true;
+    }
+}
+
+void VisibilityManager::onStrutsUpdateDeadline()
+{
+    //! struts are updated again only when changes arrived during the blocking interval
+    if (m_strutsUpdateIsPending) {
+        m_strutsUpdateIsPending = false;
         updateStrutsBasedOnLayoutsAndActivities();
     }
 }
@@ -582,6 +639,53 @@ bool VisibilityManager::isShownFully() const
     return m_isShownFully;
 }
 
+bool VisibilityManager::isSuspended() const
+{
+    return m_isSuspended;
+}
+
+void VisibilityManager::setIsSuspended(bool suspended)
+{
+    if (m_isSuspended == suspended) {
+        return;
+    }
+
+    QElapsedTimer resumeClock;
+    resumeClock.start();
+
+    m_isSuspended = suspended;
+    emit isSuspendedChanged();
+
+    if (!suspended && resumeClock.elapsed() > RESUMELATENCYBUDGET) {
+        qDebug() << "VisibilityManager: view" << traceViewId() << "resumed in" << resumeClock.elapsed()
+                 << "ms which is more than the" << RESUMELATENCYBUDGET << "ms budget";
+    }
+
+    traceTransition(suspended ? "suspended" : QString("resumed in %1 ms").arg(resumeClock.elapsed()));
+}
+
+bool VisibilityManager::canBeSuspended() const
+{
+    return m_isHidden
+            && !m_containsMouse
+            && !m_dragEnter
+            && m_pendingTransition != PendingTransition::Show
+            && !m_latteView->inEditMode();
+}
+
+void VisibilityManager::updateSuspendedState()
+{
+    if (!canBeSuspended()) {
+        m_timerSuspend.stop();
+        setIsSuspended(false);
+        return;
+    }
+
+    if (!m_isSuspended && !m_timerSuspend.isActive()) {
+        m_timerSuspend.start();
+    }
+}
+
 void VisibilityManager::setIsShownFully(bool fully)
 {
     if (m_isShownFully == fully) {
@@ -652,7 +756,7 @@ void VisibilityManager::removeBlockHidingEvent(const QString &type)
 void VisibilityManager::onHidingIsBlockedChanged()
 {
     if (hidingIsBlocked()) {
-        m_timerHide.stop();
+        cancelTransition(PendingTransition::Hide);
         emit mustBeShown();
     } else {
         updateHiddenState();
@@ -661,6 +765,12 @@ void VisibilityManager::onHidingIsBlockedChanged()
 
 void VisibilityManager::onHeadThicknessChanged()
 {
+    if (!modeUsesDeadline(Deadline::FrameExtents)) {
+        //! published when the current mode uses frame extents again
+        m_frameExtentsUpdateIsPending = true;
+        return;
+    }
+
     if (!m_timerPublishFrameExtents.isActive()) {
         m_timerPublishFrameExtents.start();
     }
@@ -711,16 +821,16 @@ void VisibilityManager::publishFrameExtents(bool forceUpdate)
 
 int VisibilityManager::timerShow() const
 {
-    return m_timerShow.interval();
+    return m_timerShowInterval;
 }
 
 void VisibilityManager::setTimerShow(int msec)
 {
-    if (m_timerShow.interval() == msec) {
+    if (m_timerShowInterval == msec) {
         return;
     }
 
-    m_timerShow.setInterval(msec);
+    m_timerShowInterval = msec;
     emit timerShowChanged();
 }
 
@@ -738,7 +848,6 @@ void VisibilityManager::setTimerHide(int msec)
     }
 
     m_timerHideInterval = interval;
-    m_timerHide.setInterval(interval);
     emit timerHideChanged();
 }
 
@@ -749,7 +858,7 @@ bool VisibilityManager::isSidebar() const
 
 bool VisibilityManager::supportsKWinEdges() const
 {
-    return (m_edgeGhostWindow != nullptr);
+    return (m_edgeTriggers != nullptr);
 }
 
 void VisibilityManager::updateGhostWindowState()
@@ -762,14 +871,14 @@ void VisibilityManager::updateGhostWindowState()
 
         if (inCurrentLayout) {
             if (m_mode == Latte::Types::WindowsCanCover) {
-                m_wm->setActiveEdge(m_edgeGhostWindow, m_isBelowLayer && !m_containsMouse);
+                m_edgeTriggers->setViewActive(m_latteView, m_isBelowLayer && !m_containsMouse);
             } else {
                 bool activated = (m_isHidden && !windowContainsMouse());
 
-                m_wm->setActiveEdge(m_edgeGhostWindow, activated);
+                m_edgeTriggers->setViewActive(m_latteView, activated);
             }
         } else {
-            m_wm->setActiveEdge(m_edgeGhostWindow, false);
+            m_edgeTriggers->setViewActive(m_latteView, false);
         }
     }
 }
@@ -829,15 +938,9 @@ void VisibilityManager::updateHiddenState()
         break;
 
     case Types::DodgeActive:
-        dodgeActive();
-        break;
-
     case Types::DodgeMaximized:
-        dodgeMaximized();
-        break;
-
     case Types::DodgeAllWindows:
-        dodgeAllWindows();
+        dodgeWindows();
         break;
 
     case Types::SidebarOnDemand:
@@ -865,18 +968,18 @@ void VisibilityManager::raiseView(bool raise)
     }
 
     if (raise) {
-        m_timerHide.stop();
+        cancelTransition(PendingTransition::Hide);
 
-        if (!m_timerShow.isActive()) {
-            m_timerShow.start();
+        if (m_pendingTransition != PendingTransition::Show) {
+            scheduleTransition(PendingTransition::Show, m_timerShowInterval);
         }
     } else if (!m_dragEnter && !hidingIsBlocked()) {
-        m_timerShow.stop();
+        cancelTransition(PendingTransition::Show);
 
         if (m_hideNow) {
             m_hideNow = false;
             emit mustBeHide();
-        } else if (!m_timerHide.isActive()) {
+        } else if (m_pendingTransition != PendingTransition::Hide) {
             startTimerHide();
         }
     }
@@ -888,13 +991,13 @@ void VisibilityManager::raiseViewTemporarily()
         return;
 
     m_raiseTemporarily = true;
-    m_timerHide.stop();
-    m_timerShow.stop();
+    cancelTransition(PendingTransition::Hide);
+    cancelTransition(PendingTransition::Show);
 
     if (m_isHidden)
         emit mustBeShown();
 
-    QTimer::singleShot(qBound(1800, 2 * m_timerHide.interval(), 3000), this, [&]() {
+    QTimer::singleShot(qBound(1800, 2 * m_timerHideInterval, 3000), this, [&]() {
         m_raiseTemporarily = false;
         m_hideNow = true;
         updateHiddenState();
@@ -908,10 +1011,6 @@ bool VisibilityManager::isValidMode() const
 
 void VisibilityManager::applyActivitiesToHiddenWindows(const QStringList &activities)
 {
-    if (m_edgeGhostWindow) {
-        m_wm->setWindowOnActivities(m_edgeGhostWindow->trackedWindowId(), activities);
-    }
-
     if (m_floatingGapWindow) {
         m_wm->setWindowOnActivities(m_floatingGapWindow->trackedWindowId(), activities);
     }
@@ -928,53 +1027,182 @@ void VisibilityManager::startTimerHide(const int &msec)
             secs = qMax(m_timerHideInterval, m_latteView->screenEdgeMargin() > 0 ? 700 : 200);
         }
 
-        m_timerHide.start(secs);
+        scheduleTransition(PendingTransition::Hide, secs);
     } else {
-        m_timerHide.start(msec);
+        scheduleTransition(PendingTransition::Hide, msec);
     }
 }
 
-void VisibilityManager::dodgeActive()
+bool VisibilityManager::modeUsesDeadline(const Deadline &deadline) const
 {
-    if (m_raiseTemporarily)
-        return;
+    bool hasTransitions = (m_mode == Types::AutoHide
+                           || m_mode == Types::DodgeActive
+                           || m_mode == Types::DodgeMaximized
+                           || m_mode == Types::DodgeAllWindows
+                           || m_mode == Types::WindowsCanCover
+                           || m_mode == Types::SidebarOnDemand
+                           || m_mode == Types::SidebarAutoHide);
 
-    //!don't send false raiseView signal when containing mouse
-    if (m_containsMouse) {
-        raiseView(true);
+    switch (deadline) {
+    case Deadline::Transition:
+        return hasTransitions;
+    case Deadline::Struts:
+        return (m_mode == Types::AlwaysVisible);
+    case Deadline::FrameExtents:
+        //! hiding modes publish their frame extents only while they are shown
+        return (m_mode != Types::None) && !(hasTransitions && m_isHidden);
+    }
+
+    return false;
+}
+
+void VisibilityManager::updateDeadlines()
+{
+    if (!modeUsesDeadline(Deadline::Transition)) {
+        if (m_pendingTransition == PendingTransition::Show) {
+            //! show requests are always delivered, modes without transitions never keep views hidden
+            m_timerTransition.stop();
+            onTransitionDeadline();
+        }
+
+        cancelTransition(PendingTransition::Hide);
+    }
+
+    if (!modeUsesDeadline(Deadline::Struts)) {
+        m_timerBlockStrutsUpdate.stop();
+        m_strutsUpdateIsPending = false;
+    }
+
+    if (!modeUsesDeadline(Deadline::FrameExtents)) {
+        if (m_timerPublishFrameExtents.isActive()) {
+            m_timerPublishFrameExtents.stop();
+            m_frameExtentsUpdateIsPending = true;
+        }
+    } else if (m_frameExtentsUpdateIsPending) {
+        m_frameExtentsUpdateIsPending = false;
+        m_timerPublishFrameExtents.start();
+    }
+}
+
+void VisibilityManager::scheduleTransition(const PendingTransition &transition, const int &msec)
+{
+    if (transition == PendingTransition::Hide && !modeUsesDeadline(Deadline::Transition)) {
+        //! show requests are always delivered, e.g. when a hidden view becomes AlwaysVisible
         return;
     }
 
-    raiseView(!m_latteView->windowsTracker()->currentScreen()->activeWindowTouching());
+    m_pendingTransition = transition;
+    m_timerTransition.start(qMax(0, msec));
+
+    if (transition == PendingTransition::Show) {
+        //! resume while the show delay is running
+        updateSuspendedState();
+    }
+
+    if (m_traceIsEnabled) {
+        traceTransition(QString("%1 scheduled in %2 ms").arg(transition == PendingTransition::Show ? "show" : "hide").arg(msec));
+    }
 }
 
-void VisibilityManager::dodgeMaximized()
+void VisibilityManager::cancelTransition(const PendingTransition &transition)
 {
-    if (m_raiseTemporarily)
+    if (m_pendingTransition != transition) {
         return;
+    }
 
-    //!don't send false raiseView signal when containing mouse
-    if (m_containsMouse) {
-        raiseView(true);
+    m_timerTransition.stop();
+    m_pendingTransition = PendingTransition::None;
+
+    if (m_traceIsEnabled) {
+        traceTransition(QString("%1 cancelled").arg(transition == PendingTransition::Show ? "show" : "hide"));
+    }
+}
+
+void VisibilityManager::onTransitionDeadline()
+{
+    PendingTransition transition = m_pendingTransition;
+    m_pendingTransition = PendingTransition::None;
+
+    if (transition == PendingTransition::Show) {
+        if (m_isHidden ||  m_isBelowLayer) {
+            emit mustBeShown();
+        }
+    } else if (transition == PendingTransition::Hide) {
+        if (!hidingIsBlocked() && !m_isHidden && !m_isBelowLayer && !m_dragEnter) {
+            if (m_isFloatingGapWindowEnabled) {
+                //! first check if mouse is inside the floating gap
+                checkMouseInFloatingArea();
+            } else {
+                //! immediate call
+                emit mustBeHide();
+            }
+        }
+    }
+}
+
+int VisibilityManager::traceViewId() const
+{
+    return m_latteView && m_latteView->containment() ? (int)m_latteView->containment()->id() : -1;
+}
+
+void VisibilityManager::traceTransition(const QString &event)
+{
+    if (!m_traceIsEnabled) {
         return;
     }
 
-    raiseView(!m_latteView->windowsTracker()->currentScreen()->activeWindowMaximized());
+    Tracer::self()->record(traceViewId(), "visibility", QString("mode: %1 hidden: %2 :: %3").arg((int)m_mode).arg(m_isHidden).arg(event));
+}
+
+bool VisibilityManager::windowsDodgeCondition() const
+{
+    auto currentScreen = m_latteView->windowsTracker()->currentScreen();
+
+    switch (m_mode) {
+    case Types::DodgeActive:
+        return currentScreen->activeWindowTouching();
+    case Types::DodgeMaximized:
+        return currentScreen->activeWindowMaximized();
+    case Types::DodgeAllWindows:
+        return currentScreen->activeWindowTouching() || currentScreen->existsWindowTouching();
+    default:
+        return false;
+    }
 }
 
-void VisibilityManager::dodgeAllWindows()
+void VisibilityManager::updateDodgeCondition()
+{
+    //! windows tracker is queried only when it informs about a change
+    bool condition = windowsDodgeCondition();
+
+    if (m_isDodgeConditionActive != condition) {
+        m_isDodgeConditionActive = condition;
+        traceTransition(QString("dodge condition %1").arg(condition ? "activated" : "deactivated"));
+
+        if (m_traceIsEnabled) {
+            if (condition && !m_isHidden) {
+                Tracer::self()->beginSpan(traceViewId(), "hide", "dodge");
+            } else if (!condition && m_isHidden) {
+                Tracer::self()->beginSpan(traceViewId(), "show", "dodge");
+            }
+        }
+    }
+
+    dodgeWindows();
+}
+
+void VisibilityManager::dodgeWindows()
 {
     if (m_raiseTemporarily)
         return;
 
+    //!don't send false raiseView signal when containing mouse
     if (m_containsMouse) {
         raiseView(true);
         return;
     }
 
-    bool windowIntersects{m_latteView->windowsTracker()->currentScreen()->activeWindowTouching() || m_latteView->windowsTracker()->currentScreen()->existsWindowTouching()};
-
-    raiseView(!windowIntersects);
+    raiseView(!m_isDodgeConditionActive);
 }
 
 void VisibilityManager::saveConfig()
@@ -986,7 +1214,7 @@ void VisibilityManager::saveConfig()
     auto config = m_latteView->containment()->config();
 
     config.writeEntry("enableKWinEdges", m_enableKWinEdgesFromUser);
-    config.writeEntry("timerShow", m_timerShow.interval());
+    config.writeEntry("timerShow", m_timerShowInterval);
     config.writeEntry("timerHide", m_timerHideInterval);
     config.writeEntry("raiseOnDesktopChange", m_raiseOnDesktopChange);
     config.writeEntry("raiseOnActivityChange", m_raiseOnActivityChange);
@@ -1023,7 +1251,7 @@ void VisibilityManager::setContainsMouse(bool contains)
 
 bool VisibilityManager::windowContainsMouse()
 {
-    return m_containsMouse || (m_edgeGhostWindow && m_edgeGhostWindow->containsMouse());
+    return m_containsMouse || (m_edgeTriggers && m_edgeTriggers->containsMouse(m_latteView));
 }
 
 void VisibilityManager::checkMouseInFloatingArea()
@@ -1041,15 +1269,32 @@ void VisibilityManager::viewEventManager(QEvent *ev)
 {
     switch (ev->type()) {
     case QEvent::Enter:
+        if (m_traceIsEnabled) {
+            Tracer::self()->cancelSpan(traceViewId(), "hide");
+
+            if (m_isHidden) {
+                Tracer::self()->beginSpan(traceViewId(), "show", "pointer");
+            }
+        }
+
         setContainsMouse(true);
         break;
 
     case QEvent::Leave:
+        if (m_traceIsEnabled && !m_isHidden
+                && (m_mode == Types::AutoHide || m_mode == Types::SidebarAutoHide || m_isDodgeConditionActive)) {
+            Tracer::self()->beginSpan(traceViewId(), "hide", "pointer");
+        }
+
         m_dragEnter = false;
         setContainsMouse(false);
         break;
 
     case QEvent::DragEnter:
+        if (m_traceIsEnabled && m_isHidden) {
+            Tracer::self()->beginSpan(traceViewId(), "show", "drag");
+        }
+
         m_dragEnter = true;
 
         if (m_isHidden && !isSidebar()) {
@@ -1117,20 +1362,29 @@ void VisibilityManager::onIsFloatingGapWindowEnabledChanged()
 
 void VisibilityManager::createEdgeGhostWindow()
 {
-    if (!m_edgeGhostWindow) {
-        m_edgeGhostWindow = new ScreenEdgeGhostWindow(m_latteView);
+    if (!m_edgeTriggers) {
+        m_edgeTriggers = m_corona->screenEdgeTriggers();
+        m_edgeTriggers->addView(m_latteView);
+
+        m_connectionsKWinEdges[1] = connect(m_edgeTriggers, &ScreenEdgeTriggers::containsMouseChanged, this, [ = ](Latte::View *view, bool contains) {
+            if (view != m_latteView) {
+                return;
+            }
+
+            if (m_traceIsEnabled && contains && m_isHidden) {
+                Tracer::self()->beginSpan(traceViewId(), "show", "edge");
+            }
 
-        connect(m_edgeGhostWindow, &ScreenEdgeGhostWindow::containsMouseChanged, this, [ = ](bool contains) {
             if (contains) {
                 raiseView(true);
             } else {
-                m_timerShow.stop();
+                cancelTransition(PendingTransition::Show);
                 updateGhostWindowState();
             }
         });
 
-        connect(m_edgeGhostWindow, &ScreenEdgeGhostWindow::dragEntered, this, [&]() {
-            if (m_isHidden) {
+        m_connectionsKWinEdges[2] = connect(m_edgeTriggers, &ScreenEdgeTriggers::dragEntered, this, [&](Latte::View *view) {
+            if (view == m_latteView && m_isHidden) {
                 emit mustBeShown();
             }
         });
@@ -1142,12 +1396,8 @@ void VisibilityManager::createEdgeGhostWindow()
                                      && m_latteView->layout() && !m_latteView->positioner()->inRelocationAnimation()
                                      && m_latteView->layout()->isCurrent()));
 
-            if (m_edgeGhostWindow) {
-                if (inCurrentLayout) {
-                    m_wm->setActiveEdge(m_edgeGhostWindow, m_isHidden);
-                } else {
-                    m_wm->setActiveEdge(m_edgeGhostWindow, false);
-                }
+            if (m_edgeTriggers) {
+                m_edgeTriggers->setViewActive(m_latteView, inCurrentLayout && m_isHidden);
             }
         });
 
@@ -1157,9 +1407,9 @@ void VisibilityManager::createEdgeGhostWindow()
 
 void VisibilityManager::deleteEdgeGhostWindow()
 {
-    if (m_edgeGhostWindow) {
-        m_edgeGhostWindow->deleteLater();
-        m_edgeGhostWindow = nullptr;
+    if (m_edgeTriggers) {
+        m_edgeTriggers->removeView(m_latteView);
+        m_edgeTriggers = nullptr;
 
         for (auto &c : m_connectionsKWinEdges) {
             disconnect(c);
@@ -14,6 +14,7 @@
 #include "../plasma/quick/containmentview.h"
 
 // Qt
+#include <QElapsedTimer>
 #include <QObject>
 #include <QTimer>
 
@@ -26,7 +27,7 @@ class Corona;
 class View;
 namespace ViewPart {
 class FloatingGapWindow;
-class ScreenEdgeGhostWindow;
+class ScreenEdgeTriggers;
 }
 namespace WindowSystem {
 class AbstractWindowInterface;
@@ -46,6 +47,8 @@ class VisibilityManager : public QObject
     Q_PROPERTY(bool raiseOnActivity READ raiseOnActivity WRITE setRaiseOnActivity NOTIFY raiseOnActivityChanged)    
     Q_PROPERTY(bool isHidden READ isHidden WRITE setIsHidden NOTIFY isHiddenChanged)
     Q_PROPERTY(bool isShownFully READ isShownFully WRITE setIsShownFully NOTIFY isShownFullyChanged)
+    //! view stays hidden long enough, animations and timers that nobody can see are paused
+    Q_PROPERTY(bool isSuspended READ isSuspended NOTIFY isSuspendedChanged)
     Q_PROPERTY(bool isBelowLayer READ isBelowLayer NOTIFY isBelowLayerChanged)    
     Q_PROPERTY(bool isSidebar READ isSidebar NOTIFY isSidebarChanged)
     Q_PROPERTY(bool containsMouse READ containsMouse NOTIFY containsMouseChanged)
@@ -67,6 +70,24 @@ class VisibilityManager : public QObject
 public:
     static const QRect ISHIDDENMASK;
 
+    //! visibility state machine, at most one show or hide deadline
+    //! is scheduled at any time
+    enum class PendingTransition
+    {
+        None = 0,
+        Show,
+        Hide
+    };
+
+    //! deadlines that visibility modes can schedule, each mode starts only the
+    //! deadlines it uses and the rest are stopped when the mode or hidden state changes
+    enum class Deadline
+    {
+        Transition = 0,
+        Struts,
+        FrameExtents
+    };
+
     explicit VisibilityManager(PlasmaQuick::ContainmentView *view);
     virtual ~VisibilityManager();
 
@@ -89,6 +110,8 @@ public:
     bool isShownFully() const;
     void setIsShownFully(bool fully);
 
+    bool isSuspended() const;
+
     bool hidingIsBlocked() const;
 
     bool containsMouse() const;
@@ -146,6 +169,7 @@ signals:
     void isHiddenChanged();
     void isSidebarChanged();
     void isShownFullyChanged();
+    void isSuspendedChanged();
     void hidingIsBlockedChanged();
     void containsMouseChanged();
     void strutsThicknessChanged();
@@ -173,8 +197,13 @@ private slots:
 
     void updateSidebarState();
 
+    void updateSuspendedState();
+
 private:
     void setContainsMouse(bool contains);
+    void setIsSuspended(bool suspended);
+
+    bool canBeSuspended() const;
 
     void raiseView(bool raise);
     void raiseViewTemporarily();
@@ -199,11 +228,13 @@ private:
     QRect acceptableStruts();
 
 private slots:
-    void dodgeAllWindows();
-    void dodgeActive();
-    void dodgeMaximized();
+    void dodgeWindows();
+    void updateDodgeCondition();
     void updateHiddenState();
 
+    void onTransitionDeadline();
+    void onStrutsUpdateDeadline();
+
     void updateStrutsAfterTimer();
 
     bool isValidMode() const;
@@ -211,6 +242,18 @@ private slots:
 private:
     void startTimerHide(const int &msec = 0);
 
+    bool modeUsesDeadline(const Deadline &deadline) const;
+    void updateDeadlines();
+
+    void scheduleTransition(const PendingTransition &transition, const int &msec);
+    void cancelTransition(const PendingTransition &transition);
+
+    bool windowsDodgeCondition() const;
+
+    //! transitions trace, enabled with -d --visibility or --trace
+    int traceViewId() const;
+    void traceTransition(const QString &event);
+
     bool canSetStrut() const;
 
 private:
@@ -218,21 +261,29 @@ private:
     Types::Visibility m_mode{Types::None};
     std::array<QMetaObject::Connection, 6> m_connections;
 
-    QTimer m_timerShow;
-    QTimer m_timerHide;
+    //! single deadline timer for the pending show/hide transition
+    QTimer m_timerTransition;
+    PendingTransition m_pendingTransition{PendingTransition::None};
+
+    //! delays suspension in order to not toggle it while the user is passing by the screen edge
+    QTimer m_timerSuspend;
+
     QTimer m_timerPublishFrameExtents;
+    bool m_frameExtentsUpdateIsPending{false};
     //! This timer is very important because it blocks how fast struts are updated.
     //! By using this timer we help the window manager in order to correspond to new
     //! struts (for example changing windows maximized state or geometry) without
     //! createing binding loops between the app and the window manager.
     //! That was reproducable in a floating panel when we were dragging the active window.
     QTimer m_timerBlockStrutsUpdate;
+    bool m_strutsUpdateIsPending{false};
 
     bool m_isBelowLayer{false};
     bool m_isHidden{false};
     bool m_isFloatingGapWindowEnabled{false};
     bool m_isSidebar{false};
     bool m_isShownFully{false};
+    bool m_isSuspended{false};
     bool m_dragEnter{false};
     bool m_containsMouse{false};
     bool m_raiseTemporarily{false};
@@ -240,10 +291,14 @@ private:
     bool m_raiseOnActivityChange{false};
     bool m_hideNow{false};
 
+    //! cached windows state from current screen tracker, updated only through its change signals
+    bool m_isDodgeConditionActive{false};
+
     //! valid on demand sidebar hidden state in order to be checked after slide-ins/outs
     bool m_isRequestedShownSidebarOnDemand{false};
 
     int m_frameExtentsHeadThicknessGap{0};
+    int m_timerShowInterval{0};
     int m_timerHideInterval{700};
     Plasma::Types::Location m_frameExtentsLocation{Plasma::Types::BottomEdge};
 
@@ -251,13 +306,17 @@ private:
 
     QStringList m_blockHidingEvents;
 
+    //! trace
+    bool m_traceIsEnabled{false};
+
     QRect m_publishedStruts;
     QRect m_lastMask;
 
     //! KWin Edges
     bool m_enableKWinEdgesFromUser{true};
-    std::array<QMetaObject::Connection, 1> m_connectionsKWinEdges;
-    ScreenEdgeGhostWindow *m_edgeGhostWindow{nullptr};
+    std::array<QMetaObject::Connection, 3> m_connectionsKWinEdges;
+    //! shared with the other views at the same screen edge, it is set only when this view uses it
+    ScreenEdgeTriggers *m_edgeTriggers{nullptr};
 
     //! Floating Gap
     FloatingGapWindow *m_floatingGapWindow{nullptr};
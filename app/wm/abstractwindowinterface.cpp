@@ -41,15 +41,9 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
     m_schemesTracker = new Tracker::Schemes(this);
 
     rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
+    m_appResolver = new AppResolver(rulesConfig, this);
 
-    m_windowWaitingTimer.setInterval(150);
-    m_windowWaitingTimer.setSingleShot(true);
-
-    connect(&m_windowWaitingTimer, &QTimer::timeout, this, [&]() {
-        WindowId wid = m_windowChangedWaiting;
-        m_windowChangedWaiting = QVariant();
-        emit windowChanged(wid);
-    });
+    connect(&m_windowChangesBatcher, &WindowChangesBatcher::batchReady, this, &AbstractWindowInterface::onWindowChangesBatchReady);
 
     connect(this, &AbstractWindowInterface::windowRemoved, this, &AbstractWindowInterface::windowRemovedSlot);
 
@@ -84,7 +78,8 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
 
 AbstractWindowInterface::~AbstractWindowInterface()
 {
-    m_windowWaitingTimer.stop();
+    //! no windows changes are sent while the interface is being deleted
+    disconnect(&m_windowChangesBatcher, nullptr, this, nullptr);
 
     m_schemesTracker->deleteLater();
     m_windowsTracker->deleteLater();
@@ -304,6 +299,8 @@ void AbstractWindowInterface::registerIgnoredWindow(WindowId wid)
 {
     if (!wid.isNull() && !m_ignoredWindows.contains(wid)) {
         m_ignoredWindows.append(wid);
+        //! the windows tracker refreshes its information through windowPropertiesChanged
+        emit windowPropertiesChanged(wid, AllChanges);
         emit windowChanged(wid);
     }
 }
@@ -320,6 +317,7 @@ void AbstractWindowInterface::registerPlasmaIgnoredWindow(WindowId wid)
 {
     if (!wid.isNull() && !m_plasmaIgnoredWindows.contains(wid)) {
         m_plasmaIgnoredWindows.append(wid);
+        emit windowPropertiesChanged(wid, AllChanges);
         emit windowChanged(wid);
     }
 }
@@ -335,6 +333,7 @@ void AbstractWindowInterface::registerWhitelistedWindow(WindowId wid)
 {
     if (!wid.isNull() && !m_whitelistedWindows.contains(wid)) {
         m_whitelistedWindows.append(wid);
+        emit windowPropertiesChanged(wid, AllChanges);
         emit windowChanged(wid);
     }
 }
@@ -348,6 +347,8 @@ void AbstractWindowInterface::unregisterWhitelistedWindow(WindowId wid)
 
 void AbstractWindowInterface::windowRemovedSlot(WindowId wid)
 {
+    m_windowChangesBatcher.removeWindow(wid);
+
     if (m_plasmaIgnoredWindows.contains(wid)) {
         unregisterPlasmaIgnoredWindow(wid);
     }
@@ -399,31 +400,60 @@ void AbstractWindowInterface::switchToPreviousActivity()
 }
 
 //! Delay window changed trigerring
-void AbstractWindowInterface::considerWindowChanged(WindowId wid)
+int AbstractWindowInterface::windowChangesDebounceInterval() const
 {
-    //! Consider if the windowChanged signal should be sent DIRECTLY or WAIT
+    return m_windowChangesBatcher.debounceInterval();
+}
 
-    if (m_windowChangedWaiting == wid && m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowWaitingTimer.start();
-        return;
-    }
+void AbstractWindowInterface::setWindowChangesDebounceInterval(const int &interval)
+{
+    m_windowChangesBatcher.setDebounceInterval(interval);
+}
 
-    if (m_windowChangedWaiting != wid && !m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowChangedWaiting = wid;
-        m_windowWaitingTimer.start();
-    }
+int AbstractWindowInterface::windowChangesLatencyBudget() const
+{
+    return m_windowChangesBatcher.latencyBudget();
+}
+
+void AbstractWindowInterface::setWindowChangesLatencyBudget(const int &budget)
+{
+    m_windowChangesBatcher.setLatencyBudget(budget);
+}
 
-    if (m_windowChangedWaiting != wid && m_windowWaitingTimer.isActive()) {
-        m_windowWaitingTimer.stop();
-        //! sent previous waiting window
-        emit windowChanged(m_windowChangedWaiting);
+bool AbstractWindowInterface::inWindowChangesBatch() const
+{
+    return m_inWindowChangesBatch;
+}
+
+void AbstractWindowInterface::updateInfo(const WindowId &wid, WindowInfoWrap &winfo, const WindowChanges &changes)
+{
+    Q_UNUSED(changes)
+    winfo = requestInfo(wid);
+}
+
+void AbstractWindowInterface::considerWindowChanged(WindowId wid, const WindowChanges &changes)
+{
+    //! Consider when the windowChanged signal should be sent
+    m_windowChangesBatcher.considerWindowChanged(wid, (int)changes);
+}
 
-        //! retrigger waiting for the upcoming window
-        m_windowChangedWaiting = wid;
-        m_windowWaitingTimer.start();
+void AbstractWindowInterface::flushWindowChanges()
+{
+    m_windowChangesBatcher.flush();
+}
+
+void AbstractWindowInterface::onWindowChangesBatchReady(const QList<WindowId> &windows, const QList<int> &changes)
+{
+    m_inWindowChangesBatch = true;
+
+    for (int i=0; i<windows.count(); ++i) {
+        emit windowPropertiesChanged(windows[i], WindowChanges(changes[i]));
+        emit windowChanged(windows[i]);
     }
+
+    m_inWindowChangesBatch = false;
+
+    emit windowChangesBatchFinished();
 }
 
 }
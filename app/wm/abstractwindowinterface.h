@@ -9,8 +9,10 @@
 
 // local
 #include <coretypes.h>
+#include "appresolver.h"
 #include "schemecolors.h"
 #include "tasktools.h"
+#include "windowchangesbatcher.h"
 #include "windowinfowrap.h"
 #include "tracker/windowstracker.h"
 
@@ -65,6 +67,19 @@ public:
         Right,
     };
 
+    //! which parts of a window information changed
+    enum WindowChange
+    {
+        NoChange = 0,
+        TitleChange = 1 << 0,
+        StateChange = 1 << 1,
+        GeometryChange = 1 << 2,
+        DesktopsChange = 1 << 3,
+        ActivitiesChange = 1 << 4,
+        AllChanges = 0xFF
+    };
+    Q_DECLARE_FLAGS(WindowChanges, WindowChange)
+
     explicit AbstractWindowInterface(QObject *parent = nullptr);
     virtual ~AbstractWindowInterface();
 
@@ -78,6 +93,8 @@ public:
     virtual WindowId activeWindow() = 0;
     virtual WindowInfoWrap requestInfo(WindowId wid) = 0;
     virtual WindowInfoWrap requestInfoActive() = 0;
+    //! updates only the parts of an already requested window information that changed
+    virtual void updateInfo(const WindowId &wid, WindowInfoWrap &winfo, const WindowChanges &changes);
 
     virtual void skipTaskBar(const QDialog &dialog) = 0;
     virtual void slideWindow(QWindow &view, Slide location) = 0;
@@ -109,6 +126,17 @@ public:
 
     bool hasBlockedTracking(const WindowId &wid) const;
 
+    //! windows changes are merged per window and they are sent in batches,
+    //! a batch is sent when no new change arrived for the debounce interval
+    //! or when its oldest change has waited for the latency budget
+    int windowChangesDebounceInterval() const;
+    void setWindowChangesDebounceInterval(const int &interval);
+
+    int windowChangesLatencyBudget() const;
+    void setWindowChangesLatencyBudget(const int &budget);
+
+    bool inWindowChangesBatch() const;
+
     QString currentDesktop();
     QString currentActivity();
 
@@ -137,6 +165,8 @@ public:
 signals:
     void activeWindowChanged(WindowId wid);
     void windowChanged(WindowId winfo);
+    void windowPropertiesChanged(WindowId wid, Latte::WindowSystem::AbstractWindowInterface::WindowChanges changes);
+    void windowChangesBatchFinished();
     void windowAdded(WindowId wid);
     void windowRemoved(WindowId wid);
     void currentDesktopChanged();
@@ -161,16 +191,17 @@ protected:
 
     QPointer<KActivities::Consumer> m_activities;
 
-    //! Sending too fast plenty of signals for the same window
-    //! has no reason and can create HIGH CPU usage. This Timer
-    //! can delay the batch sending of signals for the same window
-    WindowId m_windowChangedWaiting;
-    QTimer m_windowWaitingTimer;
+    //! delays the batch sending of signals for all changed windows
+    WindowChangesBatcher m_windowChangesBatcher;
 
     //! Plasma taskmanager rules ile
     KSharedConfig::Ptr rulesConfig;
 
-    void considerWindowChanged(WindowId wid);
+    //! caches windows to applications resolution
+    AppResolver *m_appResolver{nullptr};
+
+    void considerWindowChanged(WindowId wid, const WindowChanges &changes = AllChanges);
+    void flushWindowChanges();
 
     bool isIgnored(const WindowId &wid) const;
     bool isRegisteredPlasmaIgnoredWindow(const WindowId &wid) const;
@@ -185,6 +216,7 @@ protected:
 private slots:
     void initKWinInterface();
     void windowRemovedSlot(WindowId wid);
+    void onWindowChangesBatchReady(const QList<Latte::WindowSystem::WindowId> &windows, const QList<int> &changes);
 
     void setIsShowingDesktop(const bool &showing);
 
@@ -192,6 +224,7 @@ private slots:
 
 private:
     bool m_isShowingDesktop{false};
+    bool m_inWindowChangesBatch{false};
 
     bool m_isKWinInterfaceAvailable{false};
     bool m_isVirtualDesktopNavigationWrappingAround{true};
@@ -203,6 +236,8 @@ private:
     QDBusServiceWatcher *m_kwinServiceWatcher{nullptr};
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(AbstractWindowInterface::WindowChanges)
+
 }
 }
 
@@ -0,0 +1,272 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "appresolver.h"
+
+// Qt
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+
+// C++
+#include <algorithm>
+
+// KDE
+#include <KDirWatch>
+#include <KProcessList>
+#include <KSycoca>
+
+#define INDEXGROUP "Index"
+#define INDEXSTAMPKEY "IndexStamp"
+#define INDEXSESSIONKEY "IndexSession"
+#define INDEXFORMAT "2"
+#define RULESCONFIG "taskmanagerrulesrc"
+
+namespace Latte {
+namespace WindowSystem {
+
+AppResolver::AppResolver(KSharedConfig::Ptr rulesConfig, QObject *parent)
+    : QObject(parent),
+      m_rulesConfig(rulesConfig)
+{
+    m_urls.setMaxCost(MEMORYCACHESIZE);
+    m_appData.setMaxCost(MEMORYCACHESIZE);
+
+    QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/lattedock";
+    QDir().mkpath(cacheDir);
+
+    m_indexConfig = KSharedConfig::openConfig(cacheDir + "/appresolverindex", KConfig::SimpleConfig);
+    m_indexGroup = KConfigGroup(m_indexConfig, INDEXGROUP);
+
+    m_saveIndexTimer.setInterval(5000);
+    m_saveIndexTimer.setSingleShot(true);
+    connect(&m_saveIndexTimer, &QTimer::timeout, this, &AppResolver::saveIndex);
+
+    connect(KSycoca::self(), SIGNAL(databaseChanged(QStringList)), this, SLOT(onSycocaDatabaseChanged()));
+
+    //! user rules can map windows to different applications
+    KDirWatch::self()->addFile(QStandardPaths::writableLocation(QStandardPaths::GenericConfigLocation) + "/" + RULESCONFIG);
+    connect(KDirWatch::self(), &KDirWatch::dirty, this, &AppResolver::onRulesFileChanged, Qt::QueuedConnection);
+    connect(KDirWatch::self(), &KDirWatch::created, this, &AppResolver::onRulesFileChanged, Qt::QueuedConnection);
+    connect(KDirWatch::self(), &KDirWatch::deleted, this, &AppResolver::onRulesFileChanged, Qt::QueuedConnection);
+
+    loadIndex();
+}
+
+AppResolver::~AppResolver()
+{
+    if (m_saveIndexTimer.isActive()) {
+        saveIndex();
+    }
+}
+
+QString AppResolver::indexStamp() const
+{
+    QStringList stamp;
+    stamp << INDEXFORMAT;
+
+    QFileInfo sycocaFile(KSycoca::absoluteFilePath());
+    stamp << (sycocaFile.exists() ? QString::number(sycocaFile.lastModified().toMSecsSinceEpoch()) : QString());
+
+    //! both the user and the system wide rules are taken into account
+    for (const auto &rulesFile : QStandardPaths::locateAll(QStandardPaths::GenericConfigLocation, RULESCONFIG)) {
+        stamp << QString::number(QFileInfo(rulesFile).lastModified().toMSecsSinceEpoch());
+    }
+
+    return stamp.join("::");
+}
+
+void AppResolver::loadIndex()
+{
+    KConfigGroup general(m_indexConfig, "General");
+
+    if (general.readEntry(INDEXSTAMPKEY, QString()) != indexStamp()) {
+        //! applications database or rules changed while latte was not running
+        clearIndex();
+    } else {
+        pruneIndex();
+    }
+
+    m_session = general.readEntry(INDEXSESSIONKEY, 0) + 1;
+    general.writeEntry(INDEXSESSIONKEY, m_session);
+    m_saveIndexTimer.start();
+}
+
+void AppResolver::pruneIndex()
+{
+    const QStringList keys = m_indexGroup.keyList();
+
+    if (keys.count() <= INDEXSIZE) {
+        return;
+    }
+
+    //! each entry is [url, last session it was used in]
+    QList<QPair<int, QString>> sessions;
+
+    for (const auto &key : keys) {
+        const QStringList entry = m_indexGroup.readEntry(key, QStringList());
+        sessions << qMakePair(entry.count() == 2 ? entry[1].toInt() : 0, key);
+    }
+
+    std::sort(sessions.begin(), sessions.end());
+
+    const int removed = keys.count() - INDEXSIZE;
+
+    for (int i = 0; i < removed; ++i) {
+        m_indexGroup.deleteEntry(sessions[i].second);
+    }
+
+    qDebug() << "App resolver :: pruned" << removed << "least recently used resolved applications...";
+}
+
+void AppResolver::clearIndex()
+{
+    m_urls.clear();
+    m_appData.clear();
+    m_pendingIndexEntries.clear();
+
+    m_indexGroup.deleteGroup();
+    KConfigGroup(m_indexConfig, "General").writeEntry(INDEXSTAMPKEY, indexStamp());
+    m_saveIndexTimer.start();
+}
+
+bool AppResolver::indexedUrl(const QString &key, QUrl &url)
+{
+    if (m_pendingIndexEntries.contains(key)) {
+        url = QUrl(m_pendingIndexEntries[key][0]);
+        return true;
+    }
+
+    const QStringList entry = m_indexGroup.readEntry(key, QStringList());
+
+    if (entry.count() != 2) {
+        return false;
+    }
+
+    if (entry[1].toInt() != m_session) {
+        //! mark it as used in this session, once per session
+        m_pendingIndexEntries[key] = QStringList({entry[0], QString::number(m_session)});
+        m_saveIndexTimer.start();
+    }
+
+    url = QUrl(entry[0]);
+    return true;
+}
+
+void AppResolver::setIndexedUrl(const QString &key, const QUrl &url)
+{
+    m_pendingIndexEntries[key] = QStringList({url.toString(), QString::number(m_session)});
+    m_saveIndexTimer.start();
+}
+
+void AppResolver::saveIndex()
+{
+    for (auto it = m_pendingIndexEntries.constBegin(); it != m_pendingIndexEntries.constEnd(); ++it) {
+        m_indexGroup.writeEntry(it.key(), it.value());
+    }
+
+    m_pendingIndexEntries.clear();
+    m_indexConfig->sync();
+}
+
+void AppResolver::onSycocaDatabaseChanged()
+{
+    qDebug() << "App resolver :: applications database changed, clearing resolved applications...";
+    clearIndex();
+}
+
+void AppResolver::onRulesFileChanged(const QString &file)
+{
+    if (!file.endsWith(RULESCONFIG)) {
+        return;
+    }
+
+    qDebug() << "App resolver :: task manager rules changed, clearing resolved applications...";
+    m_rulesConfig->reparseConfiguration();
+    clearIndex();
+}
+
+QString AppResolver::processIdentity(const QString &appId, const quint32 &pid, const QString &xWindowsWMClassName) const
+{
+    if (pid == 0) {
+        return QString();
+    }
+
+    //! the same command line that servicesFromPid() matches against
+    auto proc = KProcessList::processInfo(pid);
+    const QString cmdLine = proc.isValid() ? proc.command() : QString();
+
+    if (cmdLine.isEmpty()) {
+        return QString();
+    }
+
+    KConfigGroup set(m_rulesConfig, "Settings");
+    const QStringList matchCommandLineFirst = set.readEntry("MatchCommandLineFirst", QStringList());
+
+    if ((!appId.isEmpty() && matchCommandLineFirst.contains(appId))
+            || (!xWindowsWMClassName.isEmpty() && matchCommandLineFirst.contains("::" + xWindowsWMClassName))) {
+        //! rules state that the full command line decides the application
+        return cmdLine;
+    }
+
+    //! arguments are mostly documents and urls, they would only bloat the index,
+    //! runtimes that servicesFromCmdLine() skips are identified by their script
+    const QStringList args = cmdLine.split(' ', QString::SkipEmptyParts);
+    const QStringList runtimes = set.readEntry("TryIgnoreRuntimes", QStringList());
+    const QString executable = args[0].mid(args[0].lastIndexOf('/') + 1);
+
+    if (args.count() > 1 && (runtimes.contains(args[0]) || runtimes.contains(executable))) {
+        return args[0] + " " + args[1];
+    }
+
+    return args[0];
+}
+
+QUrl AppResolver::windowUrl(const QString &appId, const quint32 &pid, const QString &xWindowsWMClassName)
+{
+    const QString windowKey = appId + "::" + xWindowsWMClassName + "::" + QString::number(pid);
+
+    if (QUrl *cached = m_urls.object(windowKey)) {
+        return *cached;
+    }
+
+    const QString identity = processIdentity(appId, pid, xWindowsWMClassName);
+
+    if (pid > 0 && identity.isEmpty()) {
+        //! the pid fallback can not be identified without its command line, e.g. no procfs
+        return windowUrlFromMetadata(appId, pid, m_rulesConfig, xWindowsWMClassName);
+    }
+
+    const QString indexKey = appId + "::" + xWindowsWMClassName + "::" + identity;
+    QUrl url;
+
+    if (!indexedUrl(indexKey, url)) {
+        url = windowUrlFromMetadata(appId, pid, m_rulesConfig, xWindowsWMClassName);
+        setIndexedUrl(indexKey, url);
+    }
+
+    m_urls.insert(windowKey, new QUrl(url));
+
+    return url;
+}
+
+AppData AppResolver::appData(const QUrl &url)
+{
+    QString key = url.toString();
+
+    if (AppData *cached = m_appData.object(key)) {
+        return *cached;
+    }
+
+    AppData data = appDataFromUrl(url);
+    m_appData.insert(key, new AppData(data));
+
+    return data;
+}
+
+}
+}
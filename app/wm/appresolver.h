@@ -0,0 +1,80 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef WINDOWSYSTEMAPPRESOLVER_H
+#define WINDOWSYSTEMAPPRESOLVER_H
+
+// local
+#include "tasktools.h"
+
+// Qt
+#include <QCache>
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+#include <QUrl>
+
+// KDE
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+namespace Latte {
+namespace WindowSystem {
+
+//! Resolves windows metadata, e.g. WM_CLASS/app_id and pid executable, to application
+//! urls and data. windowUrlFromMetadata() runs plenty of KServiceTypeTrader queries, so
+//! its results are kept in memory and in a bounded on-disk index. Both are invalidated
+//! whenever the KSycoca database or the task manager rules change.
+class AppResolver : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int MEMORYCACHESIZE = 256;
+    static const int INDEXSIZE = 512;
+
+    AppResolver(KSharedConfig::Ptr rulesConfig, QObject *parent);
+    ~AppResolver() override;
+
+    QUrl windowUrl(const QString &appId, const quint32 &pid, const QString &xWindowsWMClassName = QString());
+    AppData appData(const QUrl &url);
+
+private slots:
+    void onSycocaDatabaseChanged();
+    void onRulesFileChanged(const QString &file);
+    void saveIndex();
+
+private:
+    QString processIdentity(const QString &appId, const quint32 &pid, const QString &xWindowsWMClassName) const;
+    QString indexStamp() const;
+
+    bool indexedUrl(const QString &key, QUrl &url);
+    void setIndexedUrl(const QString &key, const QUrl &url);
+
+    void clearIndex();
+    void loadIndex();
+    void pruneIndex();
+
+private:
+    //! index session, entries not used for the most sessions are pruned first
+    int m_session{0};
+
+    //! keyed by window metadata and pid, so hits do not read the process table
+    QCache<QString, QUrl> m_urls;
+    QCache<QString, AppData> m_appData;
+
+    //! index entries are written in batches and not for each newly resolved window
+    QHash<QString, QStringList> m_pendingIndexEntries;
+    QTimer m_saveIndexTimer;
+
+    KSharedConfig::Ptr m_rulesConfig;
+    KSharedConfig::Ptr m_indexConfig;
+    KConfigGroup m_indexGroup;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "windowchangesbatcher.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QTest>
+
+using namespace Latte::WindowSystem;
+
+//! timers are allowed to fire a bit late under load
+static const int TIMERTOLERANCE = 100;
+
+class WindowChangesBatcherTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void defaults();
+    void burstIsMergedPerWindow();
+    void debounceWaitsForQuietInterval();
+    void latencyBudgetLimitsContinuousBurst();
+    void zeroLatencyBudgetFlushesImmediately();
+    void flushWithoutChanges();
+    void removedWindowIsDropped();
+
+private:
+    WindowChangesBatcher *m_batcher{nullptr};
+
+    QElapsedTimer m_clock;
+
+    QList<qint64> m_batchesAt;
+    QList<QList<WindowId>> m_batchesWindows;
+    QList<QList<int>> m_batchesChanges;
+};
+
+void WindowChangesBatcherTest::init()
+{
+    m_batchesAt.clear();
+    m_batchesWindows.clear();
+    m_batchesChanges.clear();
+
+    m_batcher = new WindowChangesBatcher(this);
+    m_clock.start();
+
+    connect(m_batcher, &WindowChangesBatcher::batchReady, this, [&](const QList<WindowId> &windows, const QList<int> &changes) {
+        m_batchesAt << m_clock.elapsed();
+        m_batchesWindows << windows;
+        m_batchesChanges << changes;
+    });
+}
+
+void WindowChangesBatcherTest::cleanup()
+{
+    delete m_batcher;
+    m_batcher = nullptr;
+}
+
+void WindowChangesBatcherTest::defaults()
+{
+    QCOMPARE(m_batcher->debounceInterval(), 150);
+    QCOMPARE(m_batcher->latencyBudget(), 500);
+    QVERIFY(!m_batcher->hasPendingChanges());
+}
+
+void WindowChangesBatcherTest::burstIsMergedPerWindow()
+{
+    for (int i=0; i<20; ++i) {
+        m_batcher->considerWindowChanged(WindowId(1), 1 << (i % 3));
+        m_batcher->considerWindowChanged(WindowId(2), 1 << 4);
+    }
+
+    QCOMPARE(m_batchesAt.count(), 0);
+    QVERIFY(m_batcher->hasPendingChanges());
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_batchesAt.count(), 1, m_batcher->latencyBudget() + TIMERTOLERANCE);
+
+    QCOMPARE(m_batchesWindows[0], QList<WindowId>({WindowId(1), WindowId(2)}));
+    QCOMPARE(m_batchesChanges[0], QList<int>({(1 << 0) | (1 << 1) | (1 << 2), 1 << 4}));
+    QVERIFY(!m_batcher->hasPendingChanges());
+}
+
+void WindowChangesBatcherTest::debounceWaitsForQuietInterval()
+{
+    qint64 lastChangeAt{0};
+
+    //! changes arrive faster than the debounce interval but within the latency budget
+    for (int i=0; i<4; ++i) {
+        m_batcher->considerWindowChanged(WindowId(1), 1);
+        lastChangeAt = m_clock.elapsed();
+        QTest::qWait(50);
+        QCOMPARE(m_batchesAt.count(), 0);
+    }
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_batchesAt.count(), 1, m_batcher->latencyBudget());
+
+    //! coarse timers can fire up to 5% earlier
+    qint64 quiet = m_batchesAt[0] - lastChangeAt;
+    QVERIFY(quiet >= m_batcher->debounceInterval() * 0.95);
+    QVERIFY(quiet <= m_batcher->debounceInterval() + TIMERTOLERANCE);
+}
+
+void WindowChangesBatcherTest::latencyBudgetLimitsContinuousBurst()
+{
+    QList<qint64> changesAt;
+
+    //! the debounce interval never expires during the burst
+    while (m_clock.elapsed() < 1200) {
+        m_batcher->considerWindowChanged(WindowId(1), 1);
+        changesAt << m_clock.elapsed();
+        QTest::qWait(50);
+    }
+
+    QVERIFY(m_batchesAt.count() >= 2);
+    QVERIFY(m_batchesAt.count() <= 3);
+
+    //! no change waited longer than the latency budget
+    for (const auto &changeAt : changesAt) {
+        for (const auto &batchAt : m_batchesAt) {
+            if (batchAt >= changeAt) {
+                QVERIFY(batchAt - changeAt <= m_batcher->latencyBudget() + TIMERTOLERANCE);
+                break;
+            }
+        }
+    }
+}
+
+void WindowChangesBatcherTest::zeroLatencyBudgetFlushesImmediately()
+{
+    m_batcher->setLatencyBudget(0);
+
+    for (int i=0; i<5; ++i) {
+        m_batcher->considerWindowChanged(WindowId(1), 1);
+    }
+
+    QCOMPARE(m_batchesAt.count(), 5);
+    QVERIFY(!m_batcher->hasPendingChanges());
+}
+
+void WindowChangesBatcherTest::flushWithoutChanges()
+{
+    m_batcher->flush();
+    QCOMPARE(m_batchesAt.count(), 0);
+
+    m_batcher->considerWindowChanged(WindowId(1), 1);
+    m_batcher->flush();
+    QCOMPARE(m_batchesAt.count(), 1);
+}
+
+void WindowChangesBatcherTest::removedWindowIsDropped()
+{
+    m_batcher->considerWindowChanged(WindowId(1), 1);
+    m_batcher->considerWindowChanged(WindowId(2), 1 << 1);
+    m_batcher->considerWindowChanged(WindowId(1), 1 << 2);
+
+    m_batcher->removeWindow(WindowId(1));
+    QVERIFY(m_batcher->hasPendingChanges());
+
+    QTRY_COMPARE_WITH_TIMEOUT(m_batchesAt.count(), 1, m_batcher->latencyBudget() + TIMERTOLERANCE);
+
+    QCOMPARE(m_batchesWindows[0], QList<WindowId>({WindowId(2)}));
+    QCOMPARE(m_batchesChanges[0], QList<int>({1 << 1}));
+
+    //! removing the only pending window leaves no batch to be sent
+    m_batcher->considerWindowChanged(WindowId(3), 1);
+    m_batcher->removeWindow(WindowId(3));
+    QVERIFY(!m_batcher->hasPendingChanges());
+
+    QTest::qWait(m_batcher->latencyBudget() + TIMERTOLERANCE);
+    QCOMPARE(m_batchesAt.count(), 1);
+
+    for (const auto &windows : m_batchesWindows) {
+        QVERIFY(!windows.contains(WindowId(1)));
+        QVERIFY(!windows.contains(WindowId(3)));
+    }
+}
+
+QTEST_GUILESS_MAIN(WindowChangesBatcherTest)
+
+#include "windowchangesbatchertest.moc"
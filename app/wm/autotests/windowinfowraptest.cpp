@@ -0,0 +1,142 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "windowinfowrap.h"
+
+// Qt
+#include <QTest>
+
+using namespace Latte::WindowSystem;
+
+static const int WINDOWSCOUNT = 1000;
+
+class WindowInfoWrapTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void equalListsAreShared();
+    void differentListsAreKept();
+    void emptyListsAreKept();
+    void manyWindowsShareOneList();
+    void unusedListsArePruned();
+
+    void benchmarkSetDesktops();
+
+private:
+    //! builds a list from scratch so it never shares data with a previous one
+    QStringList freshList(const QStringList &values) const;
+};
+
+QStringList WindowInfoWrapTest::freshList(const QStringList &values) const
+{
+    QStringList list;
+
+    for (const auto &value : values) {
+        list << QString(value.constData(), value.size());
+    }
+
+    return list;
+}
+
+void WindowInfoWrapTest::equalListsAreShared()
+{
+    WindowInfoWrap first;
+    WindowInfoWrap second;
+
+    QStringList desktops1 = freshList({"desktop-1", "desktop-2"});
+    QStringList desktops2 = freshList({"desktop-1", "desktop-2"});
+    QVERIFY(!desktops1.isSharedWith(desktops2));
+
+    first.setDesktops(desktops1);
+    second.setDesktops(desktops2);
+    QCOMPARE(first.desktops(), second.desktops());
+    QVERIFY(first.desktops().isSharedWith(second.desktops()));
+
+    first.setActivities(freshList({"activity-a"}));
+    second.setActivities(freshList({"activity-a"}));
+    QVERIFY(first.activities().isSharedWith(second.activities()));
+}
+
+void WindowInfoWrapTest::differentListsAreKept()
+{
+    WindowInfoWrap first;
+    WindowInfoWrap second;
+
+    first.setDesktops(freshList({"desktop-1"}));
+    second.setDesktops(freshList({"desktop-2"}));
+
+    QCOMPARE(first.desktops(), QStringList({"desktop-1"}));
+    QCOMPARE(second.desktops(), QStringList({"desktop-2"}));
+    QVERIFY(!first.desktops().isSharedWith(second.desktops()));
+    QVERIFY(first.isOnDesktop("desktop-1"));
+    QVERIFY(!first.isOnDesktop("desktop-2"));
+}
+
+void WindowInfoWrapTest::emptyListsAreKept()
+{
+    WindowInfoWrap info;
+    info.setDesktops(freshList({"desktop-1"}));
+    info.setDesktops(QStringList());
+
+    QVERIFY(info.desktops().isEmpty());
+    QVERIFY(!info.isOnDesktop("desktop-1"));
+}
+
+void WindowInfoWrapTest::manyWindowsShareOneList()
+{
+    QVector<WindowInfoWrap> infos(WINDOWSCOUNT);
+
+    for (auto &info : infos) {
+        info.setDesktops(freshList({"desktop-3"}));
+        info.setActivities(freshList({"activity-b", "activity-c"}));
+    }
+
+    //! all windows point to the first window's lists, one allocation per distinct list
+    for (const auto &info : infos) {
+        QVERIFY(info.desktops().isSharedWith(infos[0].desktops()));
+        QVERIFY(info.activities().isSharedWith(infos[0].activities()));
+    }
+}
+
+void WindowInfoWrapTest::unusedListsArePruned()
+{
+    //! windows go away, their unique lists must not keep growing the shared storage
+    for (int i = 0; i < WINDOWSCOUNT; ++i) {
+        WindowInfoWrap info;
+        info.setDesktops(freshList({QStringLiteral("unused-%1").arg(i)}));
+        QCOMPARE(info.desktops(), QStringList({QStringLiteral("unused-%1").arg(i)}));
+    }
+
+    //! lists still in use survive pruning and keep being shared
+    WindowInfoWrap kept;
+    kept.setDesktops(freshList({"kept"}));
+
+    for (int i = 0; i < WINDOWSCOUNT; ++i) {
+        WindowInfoWrap info;
+        info.setDesktops(freshList({QStringLiteral("unused-again-%1").arg(i)}));
+    }
+
+    WindowInfoWrap other;
+    other.setDesktops(freshList({"kept"}));
+    QVERIFY(other.desktops().isSharedWith(kept.desktops()));
+}
+
+void WindowInfoWrapTest::benchmarkSetDesktops()
+{
+    const QStringList desktops = freshList({"desktop-1", "desktop-2"});
+    QVector<WindowInfoWrap> infos(WINDOWSCOUNT);
+
+    QBENCHMARK {
+        for (auto &info : infos) {
+            info.setDesktops(desktops);
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(WindowInfoWrapTest)
+
+#include "windowinfowraptest.moc"
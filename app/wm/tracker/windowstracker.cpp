@@ -16,6 +16,7 @@
 #include "../../lattecorona.h"
 #include "../../layout/genericlayout.h"
 #include "../../layouts/manager.h"
+#include "../../tools/tracer.h"
 #include "../../view/view.h"
 #include "../../view/positioner.h"
 
@@ -70,13 +71,36 @@ Windows::~Windows()
 
 void Windows::init()
 {
-    connect(m_wm, &AbstractWindowInterface::windowChanged, this, [&](WindowId wid) {
-        m_windows[wid] = m_wm->requestInfo(wid);
-        updateAllHints();
+    connect(m_wm, &AbstractWindowInterface::windowPropertiesChanged, this, [&](WindowId wid, AbstractWindowInterface::WindowChanges changes) {
+        if (m_windows.contains(wid)) {
+            m_wm->updateInfo(wid, m_windows[wid], changes);
+        } else {
+            m_windows[wid] = m_wm->requestInfo(wid);
+            changes = AbstractWindowInterface::AllChanges;
+        }
+
+        //! window titles are not used by any hint
+        bool hintsAreAffected = (changes & ~AbstractWindowInterface::WindowChanges(AbstractWindowInterface::TitleChange));
+
+        if (hintsAreAffected) {
+            //! batched windows changes update hints only once when the batch finishes
+            if (m_wm->inWindowChangesBatch()) {
+                m_hintsUpdateIsPending = true;
+            } else {
+                updateAllHints();
+            }
+        }
 
         emit windowChanged(wid);
     });
 
+    connect(m_wm, &AbstractWindowInterface::windowChangesBatchFinished, this, [&]() {
+        if (m_hintsUpdateIsPending) {
+            m_hintsUpdateIsPending = false;
+            updateAllHints();
+        }
+    });
+
     connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [&](WindowId wid) {
         m_windows.remove(wid);
 
@@ -307,6 +331,7 @@ void Windows::setActiveWindowMaximized(Latte::View *view, bool activeMaximized)
     }
 
     m_views[view]->setActiveWindowMaximized(activeMaximized);
+    traceHint(view, "active window maximized", activeMaximized);
     emit activeWindowMaximizedChanged(view);
 }
 
@@ -326,6 +351,7 @@ void Windows::setActiveWindowTouching(Latte::View *view, bool activeTouching)
     }
 
     m_views[view]->setActiveWindowTouching(activeTouching);
+    traceHint(view, "active window touching", activeTouching);
     emit activeWindowTouchingChanged(view);
 }
 
@@ -402,6 +428,7 @@ void Windows::setExistsWindowTouching(Latte::View *view, bool windowTouching)
     }
 
     m_views[view]->setExistsWindowTouching(windowTouching);
+    traceHint(view, "exists window touching", windowTouching);
     emit existsWindowTouchingChanged(view);
 }
 
@@ -482,6 +509,15 @@ void Windows::setTouchingWindowScheme(Latte::View *view, WindowSystem::SchemeCol
     emit touchingWindowSchemeChanged(view);
 }
 
+void Windows::traceHint(Latte::View *view, const QString &hint, const bool &value)
+{
+    if (!Tracer::self()->isEnabled()) {
+        return;
+    }
+
+    Tracer::self()->record(view->containment() ? (int)view->containment()->id() : -1, "windows", QString("%1 %2").arg(hint).arg(value ? "true" : "false"));
+}
+
 LastActiveWindow *Windows::lastActiveWindow(Latte::View *view)
 {
     if (!m_views.contains(view)) {
@@ -805,13 +841,15 @@ bool Windows::isTouchingViewEdge(Latte::View *view, const WindowInfoWrap &winfo)
 
 void Windows::cleanupFaultyWindows()
 {
-    for (const auto &key : m_windows.keys()) {
-        auto winfo = m_windows[key];
+    QMutableMapIterator<WindowId, WindowInfoWrap> i(m_windows);
+
+    while (i.hasNext()) {
+        i.next();
 
         //! garbage windows removing
-        if (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0)) {
-            //qDebug() << "Faulty Geometry ::: " << winfo.wid();
-            m_windows.remove(key);
+        if (i.value().wid()<=0 || i.value().geometry() == QRect(0, 0, 0, 0)) {
+            //qDebug() << "Faulty Geometry ::: " << i.value().wid();
+            i.remove();
         }
     }
 }
@@ -997,7 +1035,7 @@ void Windows::updateHints(Latte::View *view)
         //}
         //qDebug() << " - - - - - ";
 
-        WindowInfoWrap activeInfo = m_windows[activeWinId];
+        const WindowInfoWrap &activeInfo = m_windows[activeWinId];
         WindowId mainWindowId = activeInfo.isChildWindow() ? activeInfo.parentId() : activeWinId;
 
         for (const auto &winfo : m_windows) {
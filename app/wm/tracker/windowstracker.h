@@ -144,6 +144,8 @@ private:
     void setActiveWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme);
     void setTouchingWindowScheme(Latte::View *view, WindowSystem::SchemeColors *scheme);
 
+    void traceHint(Latte::View *view, const QString &hint, const bool &value);
+
     //! Layouts
     void setActiveWindowMaximized(Latte::Layout::GenericLayout *layout, bool activeMaximized);
     void setExistsWindowActive(Latte::Layout::GenericLayout *layout, bool windowActive);
@@ -160,6 +162,9 @@ private:
     bool isTouchingViewEdge(Latte::View *view, const QRect &windowgeometry);
 
 private:
+    //! hints are updated once for a batch of windows changes
+    bool m_hintsUpdateIsPending{false};
+
     //! a timer in order to not overload the views extra hints checking because it is not
     //! really needed that often
     QTimer m_extraViewHintsTimer;
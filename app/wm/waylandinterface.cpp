@@ -220,6 +220,7 @@ void WaylandInterface::registerIgnoredWindow(WindowId wid)
             untrackWindow(w);
         }
 
+        emit windowPropertiesChanged(wid, AllChanges);
         emit windowChanged(wid);
     }
 }
@@ -571,13 +572,69 @@ WindowInfoWrap WaylandInterface::requestInfo(WindowId wid)
     return winfoWrap;
 }
 
+void WaylandInterface::updateInfo(const WindowId &wid, WindowInfoWrap &winfo, const WindowChanges &changes)
+{
+    auto w = windowFor(wid);
+
+    const WindowChanges partialChanges = TitleChange | StateChange | GeometryChange | DesktopsChange | ActivitiesChange;
+
+    if (!w || !winfo.isValid() || winfo.wid() != wid || (changes & ~partialChanges)) {
+        winfo = requestInfo(wid);
+        return;
+    }
+
+    //!used to track Plasma DesktopView windows because during startup can not be identified properly
+    if ((changes & (StateChange | GeometryChange))
+            && w->appId() == QLatin1String("org.kde.plasmashell") && !isAcceptableWindow(w)) {
+        winfo = requestInfo(wid);
+        return;
+    }
+
+    if (changes & TitleChange) {
+        winfo.setDisplay(w->title());
+    }
+
+    if (changes & StateChange) {
+        winfo.setIsActive(w->isActive());
+        winfo.setIsMinimized(w->isMinimized());
+        winfo.setIsMaxVert(w->isMaximized());
+        winfo.setIsMaxHoriz(w->isMaximized());
+        winfo.setIsFullscreen(w->isFullscreen());
+        winfo.setIsShaded(w->isShaded());
+        winfo.setIsOnAllDesktops(w->isOnAllDesktops());
+        winfo.setIsKeepAbove(w->isKeepAbove());
+        winfo.setIsKeepBelow(w->isKeepBelow());
+        winfo.setHasSkipSwitcher(w->skipSwitcher());
+        winfo.setHasSkipTaskbar(w->skipTaskbar());
+    }
+
+    if (changes & GeometryChange) {
+        winfo.setGeometry(w->geometry());
+    }
+
+    if (changes & (StateChange | GeometryChange)) {
+        //! window validity depends on skip flags and geometry
+        winfo.setIsValid(isValidWindow(w));
+    }
+
+    if (changes & DesktopsChange) {
+        winfo.setDesktops(w->plasmaVirtualDesktops());
+    }
+
+#if KF5_VERSION_MINOR >= 81
+    if (changes & ActivitiesChange) {
+        winfo.setIsOnAllActivities(w->plasmaActivities().isEmpty());
+        winfo.setActivities(w->plasmaActivities());
+    }
+#endif
+}
+
 AppData WaylandInterface::appDataFor(WindowId wid)
 {
     auto window = windowFor(wid);
 
     if (window) {
-        const AppData &data = appDataFromUrl(windowUrlFromMetadata(window->appId(),
-                                                                   window->pid(), rulesConfig));
+        const AppData &data = m_appResolver->appData(m_appResolver->windowUrl(window->appId(), window->pid()));
 
         return data;
     }
@@ -871,15 +928,45 @@ bool WaylandInterface::isAcceptableWindow(const KWayland::Client::PlasmaWindow *
     return !isSkipped;
 }
 
-void WaylandInterface::updateWindow()
+void WaylandInterface::considerSenderChanged(const WindowChanges &changes)
 {
     PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(QObject::sender());
 
     if (isValidWindow(pW)) {
-        considerWindowChanged(pW->internalId());
+        considerWindowChanged(pW->internalId(), changes);
     }
 }
 
+void WaylandInterface::updateWindow()
+{
+    considerSenderChanged(AllChanges);
+}
+
+void WaylandInterface::updateWindowTitle()
+{
+    considerSenderChanged(TitleChange);
+}
+
+void WaylandInterface::updateWindowState()
+{
+    considerSenderChanged(StateChange);
+}
+
+void WaylandInterface::updateWindowGeometry()
+{
+    considerSenderChanged(GeometryChange);
+}
+
+void WaylandInterface::updateWindowDesktops()
+{
+    considerSenderChanged(DesktopsChange);
+}
+
+void WaylandInterface::updateWindowActivities()
+{
+    considerSenderChanged(ActivitiesChange);
+}
+
 void WaylandInterface::windowUnmapped()
 {
     PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(QObject::sender());
@@ -896,23 +983,23 @@ void WaylandInterface::trackWindow(KWayland::Client::PlasmaWindow *w)
         return;
     }
 
-    connect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::minimizedChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::shadedChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::skipTaskbarChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::onAllDesktopsChanged, this, &WaylandInterface::updateWindow);
+    connect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindowTitle);
+    connect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindowGeometry);
+    connect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::minimizedChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::shadedChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::skipTaskbarChanged, this, &WaylandInterface::updateWindowState);
+    connect(w, &PlasmaWindow::onAllDesktopsChanged, this, &WaylandInterface::updateWindowState);
     connect(w, &PlasmaWindow::parentWindowChanged, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::plasmaVirtualDesktopEntered, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::plasmaVirtualDesktopLeft, this, &WaylandInterface::updateWindow);
+    connect(w, &PlasmaWindow::plasmaVirtualDesktopEntered, this, &WaylandInterface::updateWindowDesktops);
+    connect(w, &PlasmaWindow::plasmaVirtualDesktopLeft, this, &WaylandInterface::updateWindowDesktops);
 
 
 #if KF5_VERSION_MINOR >= 81
-    connect(w, &PlasmaWindow::plasmaActivityEntered, this, &WaylandInterface::updateWindow);
-    connect(w, &PlasmaWindow::plasmaActivityLeft, this, &WaylandInterface::updateWindow);
+    connect(w, &PlasmaWindow::plasmaActivityEntered, this, &WaylandInterface::updateWindowActivities);
+    connect(w, &PlasmaWindow::plasmaActivityLeft, this, &WaylandInterface::updateWindowActivities);
 #endif
 
 
@@ -925,23 +1012,23 @@ void WaylandInterface::untrackWindow(KWayland::Client::PlasmaWindow *w)
         return;
     }
 
-    disconnect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::minimizedChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::shadedChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::skipTaskbarChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::onAllDesktopsChanged, this, &WaylandInterface::updateWindow);
+    disconnect(w, &PlasmaWindow::activeChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::titleChanged, this, &WaylandInterface::updateWindowTitle);
+    disconnect(w, &PlasmaWindow::fullscreenChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::geometryChanged, this, &WaylandInterface::updateWindowGeometry);
+    disconnect(w, &PlasmaWindow::maximizedChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::minimizedChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::shadedChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::skipTaskbarChanged, this, &WaylandInterface::updateWindowState);
+    disconnect(w, &PlasmaWindow::onAllDesktopsChanged, this, &WaylandInterface::updateWindowState);
     disconnect(w, &PlasmaWindow::parentWindowChanged, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::plasmaVirtualDesktopEntered, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::plasmaVirtualDesktopLeft, this, &WaylandInterface::updateWindow);
+    disconnect(w, &PlasmaWindow::plasmaVirtualDesktopEntered, this, &WaylandInterface::updateWindowDesktops);
+    disconnect(w, &PlasmaWindow::plasmaVirtualDesktopLeft, this, &WaylandInterface::updateWindowDesktops);
 
 
 #if KF5_VERSION_MINOR >= 81
-    disconnect(w, &PlasmaWindow::plasmaActivityEntered, this, &WaylandInterface::updateWindow);
-    disconnect(w, &PlasmaWindow::plasmaActivityLeft, this, &WaylandInterface::updateWindow);
+    disconnect(w, &PlasmaWindow::plasmaActivityEntered, this, &WaylandInterface::updateWindowActivities);
+    disconnect(w, &PlasmaWindow::plasmaActivityLeft, this, &WaylandInterface::updateWindowActivities);
 #endif
 
     disconnect(w, &PlasmaWindow::unmapped, this, &WaylandInterface::windowUnmapped);
@@ -55,6 +55,7 @@ public:
     WindowId activeWindow() override;
     WindowInfoWrap requestInfo(WindowId wid) override;
     WindowInfoWrap requestInfoActive() override;
+    void updateInfo(const WindowId &wid, WindowInfoWrap &winfo, const WindowChanges &changes) override;
 
     void skipTaskBar(const QDialog &dialog) override;
     void slideWindow(QWindow &view, Slide location) override;
@@ -98,6 +99,11 @@ public:
 
 private slots:
     void updateWindow();
+    void updateWindowTitle();
+    void updateWindowState();
+    void updateWindowGeometry();
+    void updateWindowDesktops();
+    void updateWindowActivities();
     void windowUnmapped();
 
 private:
@@ -110,6 +116,7 @@ private:
     void windowCreatedProxy(KWayland::Client::PlasmaWindow *w);
     void trackWindow(KWayland::Client::PlasmaWindow *w);
     void untrackWindow(KWayland::Client::PlasmaWindow *w);
+    void considerSenderChanged(const WindowChanges &changes);
 
     KWayland::Client::PlasmaWindow *windowFor(WindowId wid);
     KWayland::Client::PlasmaShell *waylandCoronaInterface() const;
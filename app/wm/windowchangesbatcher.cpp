@@ -0,0 +1,103 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "windowchangesbatcher.h"
+
+namespace Latte {
+namespace WindowSystem {
+
+WindowChangesBatcher::WindowChangesBatcher(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &WindowChangesBatcher::flush);
+}
+
+int WindowChangesBatcher::debounceInterval() const
+{
+    return m_debounceInterval;
+}
+
+void WindowChangesBatcher::setDebounceInterval(const int &interval)
+{
+    m_debounceInterval = qMax(0, interval);
+}
+
+int WindowChangesBatcher::latencyBudget() const
+{
+    return m_latencyBudget;
+}
+
+void WindowChangesBatcher::setLatencyBudget(const int &budget)
+{
+    m_latencyBudget = qMax(0, budget);
+}
+
+bool WindowChangesBatcher::hasPendingChanges() const
+{
+    return !m_windows.isEmpty();
+}
+
+void WindowChangesBatcher::considerWindowChanged(const WindowId &wid, const int &changes)
+{
+    //! repeated changes of the same window are merged together with their changes
+    if (m_windows.isEmpty()) {
+        m_age.start();
+    }
+
+    int index = m_windows.indexOf(wid);
+
+    if (index >= 0) {
+        m_changes[index] |= changes;
+    } else {
+        m_windows << wid;
+        m_changes << changes;
+    }
+
+    qint64 waiting = m_age.elapsed();
+
+    if (waiting >= m_latencyBudget) {
+        flush();
+        return;
+    }
+
+    //! the debounce interval can not exceed the remaining latency budget
+    m_timer.start((int)qMin<qint64>(m_debounceInterval, m_latencyBudget - waiting));
+}
+
+void WindowChangesBatcher::removeWindow(const WindowId &wid)
+{
+    int index = m_windows.indexOf(wid);
+
+    if (index < 0) {
+        return;
+    }
+
+    m_windows.removeAt(index);
+    m_changes.removeAt(index);
+
+    if (m_windows.isEmpty()) {
+        m_timer.stop();
+    }
+}
+
+void WindowChangesBatcher::flush()
+{
+    m_timer.stop();
+
+    if (m_windows.isEmpty()) {
+        return;
+    }
+
+    QList<WindowId> windows = m_windows;
+    QList<int> changes = m_changes;
+    m_windows.clear();
+    m_changes.clear();
+
+    emit batchReady(windows, changes);
+}
+
+}
+}
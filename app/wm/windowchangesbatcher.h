@@ -0,0 +1,68 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef WINDOWSYSTEMWINDOWCHANGESBATCHER_H
+#define WINDOWSYSTEMWINDOWCHANGESBATCHER_H
+
+// local
+#include "windowinfowrap.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+
+namespace Latte {
+namespace WindowSystem {
+
+//! Sending too fast plenty of signals for the same windows has no reason and can
+//! create HIGH CPU usage. Changes are merged per window and they are sent in batches,
+//! a batch is sent when no new change arrived for the debounce interval or when
+//! its oldest change has waited for the latency budget
+class WindowChangesBatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int DEBOUNCEINTERVAL = 150;
+    static const int LATENCYBUDGET = 500;
+
+    WindowChangesBatcher(QObject *parent = nullptr);
+
+    int debounceInterval() const;
+    void setDebounceInterval(const int &interval);
+
+    int latencyBudget() const;
+    void setLatencyBudget(const int &budget);
+
+    bool hasPendingChanges() const;
+
+    void considerWindowChanged(const WindowId &wid, const int &changes);
+    //! removed windows are dropped together with their merged changes
+    void removeWindow(const WindowId &wid);
+
+public slots:
+    void flush();
+
+signals:
+    //! windows and their merged changes, both lists have the same order
+    void batchReady(const QList<Latte::WindowSystem::WindowId> &windows, const QList<int> &changes);
+
+private:
+    int m_debounceInterval{DEBOUNCEINTERVAL};
+    int m_latencyBudget{LATENCYBUDGET};
+
+    QList<WindowId> m_windows;
+    QList<int> m_changes;
+
+    QTimer m_timer;
+    QElapsedTimer m_age;
+};
+
+}
+}
+
+#endif
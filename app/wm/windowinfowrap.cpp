@@ -7,6 +7,72 @@
 
 #include "windowinfowrap.h"
 
+// C++
+#include <utility>
+
+// Qt
+#include <QGlobalStatic>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+namespace {
+
+//! most windows are on the same desktops and activities, so windows share
+//! one implicitly shared copy of each distinct list instead of one each
+class SharedStringLists
+{
+public:
+    QStringList shared(const QStringList &list)
+    {
+        if (list.isEmpty()) {
+            return list;
+        }
+
+        QMutexLocker locker(&m_mutex);
+
+        auto it = m_lists.constFind(list);
+
+        if (it != m_lists.constEnd()) {
+            return *it;
+        }
+
+        if (m_lists.count() >= m_pruneLimit) {
+            prune();
+        }
+
+        m_lists.insert(list);
+        return list;
+    }
+
+private:
+    //! lists that are no longer used by any window are only referenced here
+    void prune()
+    {
+        for (auto it = m_lists.begin(); it != m_lists.end();) {
+            if (it->isDetached()) {
+                it = m_lists.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        //! avoid pruning on every insertion when all lists are still in use
+        m_pruneLimit = qMax(PRUNELIMIT, 2 * m_lists.count());
+    }
+
+private:
+    static const int PRUNELIMIT = 64;
+
+    int m_pruneLimit{PRUNELIMIT};
+
+    QMutex m_mutex;
+    QSet<QStringList> m_lists;
+};
+
+Q_GLOBAL_STATIC(SharedStringLists, s_sharedStringLists)
+
+}
 
 namespace Latte {
 namespace WindowSystem {
@@ -19,102 +85,38 @@ WindowInfoWrap::WindowInfoWrap(const WindowInfoWrap &o)
     : m_wid(o.m_wid)
     , m_parentId(o.m_parentId)
     , m_geometry(o.m_geometry)
-    , m_isValid(o.m_isValid)
-    , m_isActive(o.m_isActive)
-    , m_isMinimized(o.m_isMinimized)
-    , m_isMaxVert(o.m_isMaxVert)
-    , m_isMaxHoriz(o.m_isMaxHoriz)
-    , m_isFullscreen(o.m_isFullscreen)
-    , m_isShaded(o.m_isShaded)
-    , m_isKeepAbove(o.m_isKeepAbove)
-    , m_isKeepBelow(o.m_isKeepBelow)
-    , m_hasSkipPager(o.m_hasSkipPager)
-    , m_hasSkipSwitcher(o.m_hasSkipSwitcher)
-    , m_hasSkipTaskbar(o.m_hasSkipTaskbar)
-    , m_isOnAllDesktops(o.m_isOnAllDesktops)
-    , m_isOnAllActivities(o.m_isOnAllActivities)
-    , m_isClosable(o.m_isClosable)
-    , m_isFullScreenable(o.m_isFullScreenable)
-    , m_isGroupable(o.m_isGroupable)
-    , m_isMaximizable(o.m_isMaximizable)
-    , m_isMinimizable(o.m_isMinimizable)
-    , m_isMovable(o.m_isMovable)
-    , m_isResizable(o.m_isResizable)
-    , m_isShadeable(o.m_isShadeable)
-    , m_isVirtualDesktopsChangeable(o.m_isVirtualDesktopsChangeable)
+    , m_flags(o.m_flags)
+    , m_display(o.m_display)
     , m_desktops(o.m_desktops)
     , m_activities(o.m_activities)
-    , m_display(o.m_display)
 {
 }
 
 WindowInfoWrap::WindowInfoWrap(WindowInfoWrap &&o)
-    : m_wid(o.m_wid)
-    , m_parentId(o.m_parentId)
+    : m_wid(std::move(o.m_wid))
+    , m_parentId(std::move(o.m_parentId))
     , m_geometry(o.m_geometry)
-    , m_isValid(o.m_isValid)
-    , m_isActive(o.m_isActive)
-    , m_isMinimized(o.m_isMinimized)
-    , m_isMaxVert(o.m_isMaxVert)
-    , m_isMaxHoriz(o.m_isMaxHoriz)
-    , m_isFullscreen(o.m_isFullscreen)
-    , m_isShaded(o.m_isShaded)
-    , m_isKeepAbove(o.m_isKeepAbove)
-    , m_isKeepBelow(o.m_isKeepBelow)
-    , m_hasSkipPager(o.m_hasSkipPager)
-    , m_hasSkipSwitcher(o.m_hasSkipSwitcher)
-    , m_hasSkipTaskbar(o.m_hasSkipTaskbar)
-    , m_isOnAllDesktops(o.m_isOnAllDesktops)
-    , m_isOnAllActivities(o.m_isOnAllActivities)
-    , m_isClosable(o.m_isClosable)
-    , m_isFullScreenable(o.m_isFullScreenable)
-    , m_isGroupable(o.m_isGroupable)
-    , m_isMaximizable(o.m_isMaximizable)
-    , m_isMinimizable(o.m_isMinimizable)
-    , m_isMovable(o.m_isMovable)
-    , m_isResizable(o.m_isResizable)
-    , m_isShadeable(o.m_isShadeable)
-    , m_isVirtualDesktopsChangeable(o.m_isVirtualDesktopsChangeable)
-    , m_desktops(o.m_desktops)
-    , m_activities(o.m_activities)
-    , m_display(o.m_display)
+    , m_flags(o.m_flags)
+    , m_display(std::move(o.m_display))
+    , m_desktops(std::move(o.m_desktops))
+    , m_activities(std::move(o.m_activities))
 {
 }
 
 //! Operators
 // BEGIN: definitions
+//! application name and icon are not assigned on purpose, they are resolved
+//! afterwards by the windows tracker and must survive window info updates
 WindowInfoWrap &WindowInfoWrap::operator=(WindowInfoWrap &&rhs)
 {
-    m_wid = rhs.m_wid;
-    m_parentId = rhs.m_parentId;
+    m_wid = std::move(rhs.m_wid);
+    m_parentId = std::move(rhs.m_parentId);
     m_geometry = rhs.m_geometry;
-    m_isValid = rhs.m_isValid;
-    m_isActive = rhs.m_isActive;
-    m_isMinimized = rhs.m_isMinimized;
-    m_isMaxVert = rhs.m_isMaxVert;
-    m_isMaxHoriz = rhs.m_isMaxHoriz;
-    m_isFullscreen = rhs.m_isFullscreen;
-    m_isShaded = rhs.m_isShaded;
-    m_isKeepAbove = rhs.m_isKeepAbove;
-    m_isKeepBelow = rhs.m_isKeepBelow;
-    m_hasSkipPager = rhs.m_hasSkipPager;
-    m_hasSkipSwitcher = rhs.m_hasSkipSwitcher;
-    m_hasSkipTaskbar = rhs.m_hasSkipTaskbar;
-    m_isOnAllDesktops = rhs.m_isOnAllDesktops;
-    m_isOnAllActivities = rhs.m_isOnAllActivities;
-    m_isClosable = rhs.m_isClosable;
-    m_isFullScreenable = rhs.m_isFullScreenable;
-    m_isGroupable = rhs.m_isGroupable;
-    m_isMaximizable = rhs.m_isMaximizable;
-    m_isMinimizable = rhs.m_isMinimizable;
-    m_isMovable = rhs.m_isMovable;
-    m_isResizable = rhs.m_isResizable;
-    m_isShadeable = rhs.m_isShadeable;
-    m_isVirtualDesktopsChangeable = rhs.m_isVirtualDesktopsChangeable;
+    m_flags = rhs.m_flags;
 
-    m_display = rhs.m_display;
-    m_desktops = rhs.m_desktops;
-    m_activities = rhs.m_activities;
+    m_display = std::move(rhs.m_display);
+    m_desktops = std::move(rhs.m_desktops);
+    m_activities = std::move(rhs.m_activities);
     return *this;
 }
 
@@ -123,29 +125,7 @@ WindowInfoWrap &WindowInfoWrap::operator=(const WindowInfoWrap &rhs)
     m_wid = rhs.m_wid;
     m_parentId = rhs.m_parentId;
     m_geometry = rhs.m_geometry;
-    m_isValid = rhs.m_isValid;
-    m_isActive = rhs.m_isActive;
-    m_isMinimized = rhs.m_isMinimized;
-    m_isMaxVert = rhs.m_isMaxVert;
-    m_isMaxHoriz = rhs.m_isMaxHoriz;
-    m_isFullscreen = rhs.m_isFullscreen;
-    m_isShaded = rhs.m_isShaded;
-    m_isKeepAbove = rhs.m_isKeepAbove;
-    m_isKeepBelow = rhs.m_isKeepBelow;
-    m_hasSkipPager = rhs.m_hasSkipPager;
-    m_hasSkipSwitcher = rhs.m_hasSkipSwitcher;
-    m_hasSkipTaskbar = rhs.m_hasSkipTaskbar;
-    m_isOnAllDesktops = rhs.m_isOnAllDesktops;
-    m_isOnAllActivities = rhs.m_isOnAllActivities;
-    m_isClosable = rhs.m_isClosable;
-    m_isFullScreenable = rhs.m_isFullScreenable;
-    m_isGroupable = rhs.m_isGroupable;
-    m_isMaximizable = rhs.m_isMaximizable;
-    m_isMinimizable = rhs.m_isMinimizable;
-    m_isMovable = rhs.m_isMovable;
-    m_isResizable = rhs.m_isResizable;
-    m_isShadeable = rhs.m_isShadeable;
-    m_isVirtualDesktopsChangeable = rhs.m_isVirtualDesktopsChangeable;
+    m_flags = rhs.m_flags;
 
     m_display = rhs.m_display;
     m_desktops = rhs.m_desktops;
@@ -153,232 +133,246 @@ WindowInfoWrap &WindowInfoWrap::operator=(const WindowInfoWrap &rhs)
     return *this;
 }
 
+bool WindowInfoWrap::flag(const Flag &state) const
+{
+    return (m_flags & state);
+}
+
+void WindowInfoWrap::setFlag(const Flag &state, const bool &enabled)
+{
+    if (enabled) {
+        m_flags |= state;
+    } else {
+        m_flags &= ~state;
+    }
+}
+
 //! Access properties
 bool WindowInfoWrap::isValid() const
 {
-    return m_isValid;
+    return flag(IsValidFlag);
 }
 
 void WindowInfoWrap::setIsValid(bool isValid)
 {
-    m_isValid = isValid;
+    setFlag(IsValidFlag, isValid);
 }
 
 bool WindowInfoWrap::isActive() const
 {
-    return m_isActive;
+    return flag(IsActiveFlag);
 }
 
 void WindowInfoWrap::setIsActive(bool isActive)
 {
-    m_isActive = isActive;
+    setFlag(IsActiveFlag, isActive);
 }
 
 bool WindowInfoWrap::isMinimized() const
 {
-    return m_isMinimized;
+    return flag(IsMinimizedFlag);
 }
 
 void WindowInfoWrap::setIsMinimized(bool isMinimized)
 {
-    m_isMinimized = isMinimized;
+    setFlag(IsMinimizedFlag, isMinimized);
 }
 
 bool WindowInfoWrap::isMaximized() const
 {
-    return m_isMaxVert && m_isMaxHoriz;
+    return flag(IsMaxVertFlag) && flag(IsMaxHorizFlag);
 }
 
 bool WindowInfoWrap::isMaxVert() const
 {
-    return m_isMaxVert;
+    return flag(IsMaxVertFlag);
 }
 
 void WindowInfoWrap::setIsMaxVert(bool isMaxVert)
 {
-    m_isMaxVert = isMaxVert;
+    setFlag(IsMaxVertFlag, isMaxVert);
 }
 
 bool WindowInfoWrap::isMaxHoriz() const
 {
-    return m_isMaxHoriz;
+    return flag(IsMaxHorizFlag);
 }
 
 void WindowInfoWrap::setIsMaxHoriz(bool isMaxHoriz)
 {
-    m_isMaxHoriz = isMaxHoriz;
+    setFlag(IsMaxHorizFlag, isMaxHoriz);
 }
 
 bool WindowInfoWrap::isFullscreen() const
 {
-    return m_isFullscreen;
+    return flag(IsFullscreenFlag);
 }
 
 void WindowInfoWrap::setIsFullscreen(bool isFullscreen)
 {
-    m_isFullscreen = isFullscreen;
+    setFlag(IsFullscreenFlag, isFullscreen);
 }
 
 bool WindowInfoWrap::isShaded() const
 {
-    return m_isShaded;
+    return flag(IsShadedFlag);
 }
 
 void WindowInfoWrap::setIsShaded(bool isShaded)
 {
-    m_isShaded = isShaded;
+    setFlag(IsShadedFlag, isShaded);
 }
 
 bool WindowInfoWrap::isKeepAbove() const
 {
-    return m_isKeepAbove;
+    return flag(IsKeepAboveFlag);
 }
 
 void WindowInfoWrap::setIsKeepAbove(bool isKeepAbove)
 {
-    m_isKeepAbove = isKeepAbove;
+    setFlag(IsKeepAboveFlag, isKeepAbove);
 }
 
 bool WindowInfoWrap::isKeepBelow() const
 {
-    return m_isKeepBelow;
+    return flag(IsKeepBelowFlag);
 }
 
 void WindowInfoWrap::setIsKeepBelow(bool isKeepBelow)
 {
-    m_isKeepBelow = isKeepBelow;
+    setFlag(IsKeepBelowFlag, isKeepBelow);
 }
 
 bool WindowInfoWrap::hasSkipPager() const
 {
-    return m_hasSkipPager;
+    return flag(HasSkipPagerFlag);
 }
 
 void WindowInfoWrap::setHasSkipPager(bool skipPager)
 {
-    m_hasSkipPager = skipPager;
+    setFlag(HasSkipPagerFlag, skipPager);
 }
 
 bool WindowInfoWrap::hasSkipSwitcher() const
 {
-    return m_hasSkipSwitcher;
+    return flag(HasSkipSwitcherFlag);
 }
 
 void WindowInfoWrap::setHasSkipSwitcher(bool skipSwitcher)
 {
-    m_hasSkipSwitcher = skipSwitcher;
+    setFlag(HasSkipSwitcherFlag, skipSwitcher);
 }
 
 bool WindowInfoWrap::hasSkipTaskbar() const
 {
-    return m_hasSkipTaskbar;
+    return flag(HasSkipTaskbarFlag);
 }
 
 void WindowInfoWrap::setHasSkipTaskbar(bool skipTaskbar)
 {
-    m_hasSkipTaskbar = skipTaskbar;
+    setFlag(HasSkipTaskbarFlag, skipTaskbar);
 }
 
 bool WindowInfoWrap::isOnAllDesktops() const
 {
-    return m_isOnAllDesktops;
+    return flag(IsOnAllDesktopsFlag);
 }
 
 void WindowInfoWrap::setIsOnAllDesktops(bool alldesktops)
 {
-    m_isOnAllDesktops = alldesktops;
+    setFlag(IsOnAllDesktopsFlag, alldesktops);
 }
 
 bool WindowInfoWrap::isOnAllActivities() const
 {
-    return m_isOnAllActivities;
+    return flag(IsOnAllActivitiesFlag);
 }
 
 void WindowInfoWrap::setIsOnAllActivities(bool allactivities)
 {
-    m_isOnAllActivities = allactivities;
+    setFlag(IsOnAllActivitiesFlag, allactivities);
 }
 
 //!BEGIN: Window Abilities
 bool WindowInfoWrap::isCloseable() const
 {
-    return m_isClosable;
+    return flag(IsClosableFlag);
 }
 void WindowInfoWrap::setIsClosable(bool closable)
 {
-    m_isClosable = closable;
+    setFlag(IsClosableFlag, closable);
 }
 
 bool WindowInfoWrap::isFullScreenable() const
 {
-    return m_isFullScreenable;
+    return flag(IsFullScreenableFlag);
 }
 void WindowInfoWrap::setIsFullScreenable(bool fullscreenable)
 {
-    m_isFullScreenable = fullscreenable;
+    setFlag(IsFullScreenableFlag, fullscreenable);
 }
 
 bool WindowInfoWrap::isGroupable() const
 {
-    return m_isGroupable;
+    return flag(IsGroupableFlag);
 }
 void WindowInfoWrap::setIsGroupable(bool groupable)
 {
-    m_isGroupable = groupable;
+    setFlag(IsGroupableFlag, groupable);
 }
 
 bool WindowInfoWrap::isMaximizable() const
 {
-    return m_isMaximizable;
+    return flag(IsMaximizableFlag);
 }
 void WindowInfoWrap::setIsMaximizable(bool maximizable)
 {
-    m_isMaximizable = maximizable;
+    setFlag(IsMaximizableFlag, maximizable);
 }
 
 bool WindowInfoWrap::isMinimizable() const
 {
-    return m_isMinimizable;
+    return flag(IsMinimizableFlag);
 }
 void WindowInfoWrap::setIsMinimizable(bool minimizable)
 {
-    m_isMinimizable = minimizable;
+    setFlag(IsMinimizableFlag, minimizable);
 }
 
 bool WindowInfoWrap::isMovable() const
 {
-    return m_isMovable;
+    return flag(IsMovableFlag);
 }
 void WindowInfoWrap::setIsMovable(bool movable)
 {
-    m_isMovable = movable;
+    setFlag(IsMovableFlag, movable);
 }
 
 bool WindowInfoWrap::isResizable() const
 {
-    return m_isResizable;
+    return flag(IsResizableFlag);
 }
 void WindowInfoWrap::setIsResizable(bool resizable)
 {
-    m_isResizable = resizable;
+    setFlag(IsResizableFlag, resizable);
 }
 
 bool WindowInfoWrap::isShadeable() const
 {
-    return m_isShadeable;
+    return flag(IsShadeableFlag);
 }
 void WindowInfoWrap::setIsShadeable(bool shadeble)
 {
-    m_isShadeable = shadeble;
+    setFlag(IsShadeableFlag, shadeble);
 }
 
 bool WindowInfoWrap::isVirtualDesktopsChangeable() const
 {
-    return m_isVirtualDesktopsChangeable;
+    return flag(IsVirtualDesktopsChangeableFlag);
 }
 void WindowInfoWrap::setIsVirtualDesktopsChangeable(bool virtualdesktopchangeable)
 {
-    m_isVirtualDesktopsChangeable = virtualdesktopchangeable;
+    setFlag(IsVirtualDesktopsChangeableFlag, virtualdesktopchangeable);
 }
 //!END: Window Abilities
 
@@ -466,7 +460,7 @@ QStringList WindowInfoWrap::desktops() const
 
 void WindowInfoWrap::setDesktops(const QStringList &desktops)
 {
-    m_desktops = desktops;
+    m_desktops = s_sharedStringLists->shared(desktops);
 }
 
 QStringList WindowInfoWrap::activities() const
@@ -476,17 +470,17 @@ QStringList WindowInfoWrap::activities() const
 
 void WindowInfoWrap::setActivities(const QStringList &activities)
 {
-    m_activities = activities;
+    m_activities = s_sharedStringLists->shared(activities);
 }
 
 bool WindowInfoWrap::isOnDesktop(const QString &desktop) const
 {
-    return m_isOnAllDesktops || m_desktops.contains(desktop);
+    return flag(IsOnAllDesktopsFlag) || m_desktops.contains(desktop);
 }
 
 bool WindowInfoWrap::isOnActivity(const QString &activity) const
 {
-    return m_isOnAllActivities || m_activities.contains(activity);
+    return flag(IsOnAllActivitiesFlag) || m_activities.contains(activity);
 }
 
 }
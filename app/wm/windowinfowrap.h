@@ -132,38 +132,45 @@ public:
     bool isOnDesktop(const QString &desktop) const;
     bool isOnActivity(const QString &activity) const;
 
+private:
+    //! all window states and abilities are packed in a single bitset
+    enum Flag
+    {
+        IsValidFlag = 1 << 0,
+        IsActiveFlag = 1 << 1,
+        IsMinimizedFlag = 1 << 2,
+        IsMaxVertFlag = 1 << 3,
+        IsMaxHorizFlag = 1 << 4,
+        IsFullscreenFlag = 1 << 5,
+        IsShadedFlag = 1 << 6,
+        IsKeepAboveFlag = 1 << 7,
+        IsKeepBelowFlag = 1 << 8,
+        HasSkipPagerFlag = 1 << 9,
+        HasSkipSwitcherFlag = 1 << 10,
+        HasSkipTaskbarFlag = 1 << 11,
+        IsOnAllDesktopsFlag = 1 << 12,
+        IsOnAllActivitiesFlag = 1 << 13,
+        IsClosableFlag = 1 << 14,
+        IsFullScreenableFlag = 1 << 15,
+        IsGroupableFlag = 1 << 16,
+        IsMaximizableFlag = 1 << 17,
+        IsMinimizableFlag = 1 << 18,
+        IsMovableFlag = 1 << 19,
+        IsResizableFlag = 1 << 20,
+        IsShadeableFlag = 1 << 21,
+        IsVirtualDesktopsChangeableFlag = 1 << 22
+    };
+
+    bool flag(const Flag &state) const;
+    void setFlag(const Flag &state, const bool &enabled);
+
 private:
     WindowId m_wid{0};
     WindowId m_parentId{0};
 
     QRect m_geometry;
 
-    bool m_isValid{false};
-    bool m_isActive{false};
-    bool m_isMinimized{false};
-    bool m_isMaxVert{false};
-    bool m_isMaxHoriz{false};
-    bool m_isFullscreen{false};
-    bool m_isShaded{false};
-    bool m_isKeepAbove{false};
-    bool m_isKeepBelow{false};
-    bool m_hasSkipPager{false};
-    bool m_hasSkipSwitcher{false};
-    bool m_hasSkipTaskbar{false};
-    bool m_isOnAllDesktops{false};
-    bool m_isOnAllActivities{false};
-
-    //!BEGIN: Window Abilities
-    bool m_isClosable{false};
-    bool m_isFullScreenable{false};
-    bool m_isGroupable{false};
-    bool m_isMaximizable{false};
-    bool m_isMinimizable{false};
-    bool m_isMovable{false};
-    bool m_isResizable{false};
-    bool m_isShadeable{false};
-    bool m_isVirtualDesktopsChangeable{false};
-    //!END: Window Abilities
+    quint32 m_flags{0};
 
     QString m_appName;
     QString m_display;
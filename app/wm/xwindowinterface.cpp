@@ -496,7 +496,7 @@ WindowInfoWrap XWindowInterface::requestInfo(WindowId wid)
 
 AppData XWindowInterface::appDataFor(WindowId wid)
 {
-    return appDataFromUrl(windowUrl(wid));
+    return m_appResolver->appData(windowUrl(wid));
 }
 
 QUrl XWindowInterface::windowUrl(WindowId wid)
@@ -529,9 +529,9 @@ QUrl XWindowInterface::windowUrl(WindowId wid)
         }
     }
 
-    return windowUrlFromMetadata(info.windowClassClass(),
-                                 NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid(),
-                                 rulesConfig, info.windowClassName());
+    return m_appResolver->windowUrl(info.windowClassClass(),
+                                    NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid(),
+                                    info.windowClassName());
 }
 
 bool XWindowInterface::windowCanBeDragged(WindowId wid)
@@ -815,7 +815,29 @@ void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::P
         return;
     }
 
-    considerWindowChanged(wid);
+    WindowChanges changes = NoChange;
+
+    if (prop1 & (NET::WMName | NET::WMVisibleName)) {
+        changes |= TitleChange;
+    }
+
+    if (prop1 & (NET::WMState | NET::ActiveWindow)) {
+        changes |= StateChange;
+    }
+
+    if (prop1 & NET::WMGeometry) {
+        changes |= GeometryChange;
+    }
+
+    if (prop2 & NET::WM2Activities) {
+        changes |= ActivitiesChange;
+    }
+
+    if ((prop2 & NET::WM2TransientFor) || changes == NoChange) {
+        changes = AllChanges;
+    }
+
+    considerWindowChanged(wid, changes);
 }
 
 }
@@ -13,7 +13,10 @@ import "./privates" as Ability
 
 Ability.AnimationsPrivate {
     //! Public Properties
-    active: plasmoid.configuration.animationsEnabled && LatteCore.WindowSystem.compositingActive
+    //! suspended views are not shown, so animations that nobody can see are skipped
+    active: plasmoid.configuration.animationsEnabled
+            && LatteCore.WindowSystem.compositingActive
+            && !(latteView && latteView.visibility && latteView.visibility.isSuspended)
 
     duration.large: LatteCore.Environment.longDuration
     duration.proposed: speedFactor.current * 2.8 * duration.large
@@ -80,6 +80,17 @@ Ability.LaunchersPrivate {
                                                               orderedlaunchers);
     }
 
+    function beginSyncedBatch(senderId, group, groupId) {
+        layoutsManager.syncedLaunchers.beginBatch(layoutName,
+                                                  senderId,
+                                                  group,
+                                                  groupId);
+    }
+
+    function commitSyncedBatch(senderId) {
+        layoutsManager.syncedLaunchers.commitBatch(senderId);
+    }
+
     function addDroppedLaunchersInStealingApplet(launchers) {
         if (hasStealingApplet) {
             appletStealingDroppedLaunchers.addDroppedLaunchers(launchers);
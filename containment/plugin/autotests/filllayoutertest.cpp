@@ -0,0 +1,193 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+// local
+#include "filllayouter.h"
+
+// Qt
+#include <QTest>
+
+using namespace Latte::Containment;
+
+//! expected values are the ones that the js implementation in LayouterPrivate.qml produced
+class FillLayouterTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void oneStepPreferredAndNeutralApplets();
+    void oneStepZeroMaximumIsIgnored();
+    void oneStepStaticApplet();
+    void oneStepRemainedSpaceToMostDemanding();
+    void oneStepNoLeftover();
+    void twoStepsStartLayoutOnly();
+    void twoStepsAroundMainGridLength();
+    void twoStepsNegativeLeftover();
+    void noFillApplets();
+
+private:
+    FillAppletData applet(qreal min, qreal pref, qreal max, bool hasMetrics = true) const;
+    FillLayoutData layout(int shownApplets, int sizeWithNoFillApplets, int length, const QVector<FillAppletData> &applets) const;
+};
+
+FillAppletData FillLayouterTest::applet(qreal min, qreal pref, qreal max, bool hasMetrics) const
+{
+    FillAppletData data;
+    data.minimumLength = min;
+    data.preferredLength = pref;
+    data.maximumLength = max;
+    data.hasMetrics = hasMetrics;
+    return data;
+}
+
+FillLayoutData FillLayouterTest::layout(int shownApplets, int sizeWithNoFillApplets, int length, const QVector<FillAppletData> &applets) const
+{
+    FillLayoutData data;
+    data.fillApplets = applets.count();
+    data.shownApplets = shownApplets;
+    data.sizeWithNoFillApplets = sizeWithNoFillApplets;
+    data.length = length;
+    data.applets = applets;
+    return data;
+}
+
+void FillLayouterTest::oneStepPreferredAndNeutralApplets()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(3, 100, 0, {applet(10, 50, 100), applet(-1, -1, -1)});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, false, 500, 300);
+
+    //! max pass: 400 available, the preferred applet takes 50 and the neutral one the rest
+    QCOMPARE(main.applets[0].maxAutoFillLength, 50);
+    QCOMPARE(main.applets[1].maxAutoFillLength, 350);
+
+    //! min pass: 200 available, the maximum length of the first pass is consumed
+    QCOMPARE(main.applets[0].minAutoFillLength, 50);
+    QCOMPARE(main.applets[1].minAutoFillLength, 150);
+
+    QVERIFY(!main.applets[0].inFillCalculations);
+    QVERIFY(!main.applets[1].inFillCalculations);
+}
+
+void FillLayouterTest::oneStepZeroMaximumIsIgnored()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(2, 0, 0, {applet(10, 50, 0), applet(-1, -1, -1)});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, false, 400, 400);
+
+    //! maximumLength=0 is treated as no maximum, bug #445869
+    QCOMPARE(main.applets[0].maxAutoFillLength, 50);
+    QCOMPARE(main.applets[1].maxAutoFillLength, 350);
+}
+
+void FillLayouterTest::oneStepStaticApplet()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(2, 0, 0, {applet(60, -1, 60), applet(-1, -1, -1)});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, false, 300, 300);
+
+    QCOMPARE(main.applets[0].maxAutoFillLength, 60);
+    QCOMPARE(main.applets[1].maxAutoFillLength, 240);
+}
+
+void FillLayouterTest::oneStepRemainedSpaceToMostDemanding()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(1, 0, 0, {applet(10, 50, 100)});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, false, 400, 30);
+
+    //! max pass: the only applet is assigned 50 and then gains the remaining 350
+    QCOMPARE(main.applets[0].maxAutoFillLength, 400);
+
+    //! min pass: the applet is bounded by the available space
+    QCOMPARE(main.applets[0].minAutoFillLength, 30);
+}
+
+void FillLayouterTest::oneStepNoLeftover()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(2, 500, 0, {applet(100, 200, 300), applet(100, 200, 300)});
+    FillLayoutData end;
+
+    //! non fill applets already exceed the available length
+    FillLayouter::computeFillLengths(start, main, end, false, 400, 300);
+
+    for (const auto &data : main.applets) {
+        QCOMPARE(data.maxAutoFillLength, 100);
+        QCOMPARE(data.minAutoFillLength, 100);
+    }
+}
+
+void FillLayouterTest::twoStepsStartLayoutOnly()
+{
+    FillLayoutData start = layout(1, 0, 0, {applet(-1, -1, -1)});
+    FillLayoutData main = layout(1, 100, 100, {});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, true, 1000, 100);
+
+    //! half length minus half of the centered layout
+    QCOMPARE(start.applets[0].maxAutoFillLength, 450);
+    QCOMPARE(start.applets[0].minAutoFillLength, 0);
+}
+
+void FillLayouterTest::twoStepsAroundMainGridLength()
+{
+    FillLayoutData start = layout(1, 0, 0, {applet(-1, -1, -1)});
+    FillLayoutData main = layout(1, 0, 900, {applet(-1, -1, -1)});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, true, 1000, 1000);
+
+    //! start applets are adjusted to the centered grid length
+    QCOMPARE(start.applets[0].maxAutoFillLength, 50);
+    QCOMPARE(main.applets[0].maxAutoFillLength, 100);
+}
+
+void FillLayouterTest::twoStepsNegativeLeftover()
+{
+    FillAppletData startApplet = applet(-1, -1, -1);
+    startApplet.minAutoFillLength = 77;
+    startApplet.maxAutoFillLength = 77;
+
+    FillAppletData mainApplet = applet(-1, -1, -1);
+    mainApplet.minAutoFillLength = 77;
+    mainApplet.maxAutoFillLength = 77;
+
+    FillLayoutData start = layout(1, 0, 0, {startApplet});
+    FillLayoutData main = layout(1, 0, 1200, {mainApplet});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, true, 1000, 100);
+
+    //! centered grid is longer than the view, previous lengths are kept
+    QCOMPARE(start.applets[0].maxAutoFillLength, 77);
+    QCOMPARE(start.applets[0].minAutoFillLength, 77);
+    QCOMPARE(main.applets[0].maxAutoFillLength, 77);
+    QCOMPARE(main.applets[0].minAutoFillLength, 77);
+}
+
+void FillLayouterTest::noFillApplets()
+{
+    FillLayoutData start;
+    FillLayoutData main = layout(2, 100, 100, {});
+    FillLayoutData end;
+
+    FillLayouter::computeFillLengths(start, main, end, true, 1000, 100);
+
+    QVERIFY(main.applets.isEmpty());
+}
+
+QTEST_GUILESS_MAIN(FillLayouterTest)
+
+#include "filllayoutertest.moc"
@@ -0,0 +1,477 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "filllayouter.h"
+
+// Qt
+#include <QtMath>
+
+namespace Latte{
+namespace Containment{
+
+FillLayouter::FillLayouter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QQuickItem *FillLayouter::startContainer() const
+{
+    return m_startContainer;
+}
+
+void FillLayouter::setStartContainer(QQuickItem *container)
+{
+    if (m_startContainer == container) {
+        return;
+    }
+
+    m_startContainer = container;
+    emit startContainerChanged();
+}
+
+QQuickItem *FillLayouter::mainContainer() const
+{
+    return m_mainContainer;
+}
+
+void FillLayouter::setMainContainer(QQuickItem *container)
+{
+    if (m_mainContainer == container) {
+        return;
+    }
+
+    m_mainContainer = container;
+    emit mainContainerChanged();
+}
+
+QQuickItem *FillLayouter::endContainer() const
+{
+    return m_endContainer;
+}
+
+void FillLayouter::setEndContainer(QQuickItem *container)
+{
+    if (m_endContainer == container) {
+        return;
+    }
+
+    m_endContainer = container;
+    emit endContainerChanged();
+}
+
+//! same conversion that qml applies when a real number is assigned to an int property
+int FillLayouter::toFillLength(const qreal &length)
+{
+    if (!qIsFinite(length)) {
+        return 0;
+    }
+
+    return static_cast<int>(length);
+}
+
+//! qBound style function that is specialized in Layouts
+//! meaning that -1 values are ignored for fillWidth(s)/Height(s)
+qreal FillLayouter::appletPreferredLength(qreal min, qreal pref, qreal max)
+{
+    if (max == -1) {
+        max = (pref == -1) ? min : pref;
+    }
+
+    if (pref == -1) {
+        pref = (max == -1) ? min : pref;
+    }
+
+    return qMin(qMax(min, pref), max);
+}
+
+FillLayoutData FillLayouter::layoutData(QQuickItem *container) const
+{
+    FillLayoutData layout;
+
+    if (!container) {
+        return layout;
+    }
+
+    layout.fillApplets = container->property("fillApplets").toInt();
+    layout.shownApplets = container->property("shownApplets").toInt();
+    layout.sizeWithNoFillApplets = container->property("sizeWithNoFillApplets").toInt();
+
+    QQuickItem *grid = container->property("grid").value<QQuickItem *>();
+
+    if (!grid) {
+        return layout;
+    }
+
+    layout.length = grid->property("length").toInt();
+
+    const auto children = grid->childItems();
+
+    for (const auto child : children) {
+        if (!child || !child->property("isAutoFillApplet").toBool() || child->property("isHidden").toBool()) {
+            continue;
+        }
+
+        FillAppletData applet;
+        applet.item = child;
+        applet.hasMetrics = child->property("isInternalViewSplitter").toBool()
+                || child->property("applet").value<QObject *>() != nullptr;
+        applet.minimumLength = child->property("appletMinimumLength").toReal();
+        applet.preferredLength = child->property("appletPreferredLength").toReal();
+        applet.maximumLength = child->property("appletMaximumLength").toReal();
+        applet.minAutoFillLength = child->property("minAutoFillLength").toInt();
+        applet.maxAutoFillLength = child->property("maxAutoFillLength").toInt();
+
+        layout.applets << applet;
+    }
+
+    return layout;
+}
+
+void FillLayouter::applyLayoutData(const FillLayoutData &layout)
+{
+    for (const auto &applet : layout.applets) {
+        if (!applet.item) {
+            continue;
+        }
+
+        if (applet.item->property("maxAutoFillLength").toInt() != applet.maxAutoFillLength) {
+            applet.item->setProperty("maxAutoFillLength", applet.maxAutoFillLength);
+        }
+
+        if (applet.item->property("minAutoFillLength").toInt() != applet.minAutoFillLength) {
+            applet.item->setProperty("minAutoFillLength", applet.minAutoFillLength);
+        }
+
+        if (applet.item->property("inFillCalculations").toBool() != applet.inFillCalculations) {
+            applet.item->setProperty("inFillCalculations", applet.inFillCalculations);
+        }
+    }
+}
+
+//! initialize applets flag "inFillCalculations" in order
+//! to inform them that new calculations are taking place
+void FillLayouter::initLayoutForFillsCalculations(FillLayoutData &layout)
+{
+    for (auto &applet : layout.applets) {
+        applet.inFillCalculations = true;
+    }
+}
+
+//! during step1/pass1 all applets that provide valid metrics (minimum/preferred/maximum values)
+//! they gain a valid space in order to draw themeselves
+void FillLayouter::computeStep1ForLayout(FillLayoutData &layout, qreal &availableSpace, qreal &sizePerApplet, int &noOfApplets, const bool &inMaxAutoFillCalculations)
+{
+    for (auto &applet : layout.applets) {
+        if (!applet.hasMetrics) {
+            continue;
+        }
+
+        qreal minSize = (applet.minimumLength >= 0 && qIsFinite(applet.minimumLength)) ? applet.minimumLength : -1;
+        qreal prefSize = (minSize >= 0 && qIsFinite(applet.preferredLength)) ? applet.preferredLength : -1;
+
+        //! Qt ignores maximumlength=0 for applets that have set Layout.fillLength flag
+        //! this was tracked through bug #445869, mediacontroller_plus applet case
+        qreal maxSize = (applet.maximumLength > 0 && qIsFinite(applet.maximumLength)) ? applet.maximumLength : -1;
+
+        qreal appliedSize = -1;
+
+        //! check if the applet does not provide any valid metrics and for that case
+        //! the system must decide what space to be given after the applets that provide
+        //! nice metrics are assigned their sizes
+        bool staticSize = (minSize >= 0 && maxSize == minSize);
+        bool systemDecide = (prefSize < 0 && !staticSize);
+
+        if (systemDecide) {
+            continue;
+        }
+
+        if (noOfApplets > 1) {
+            appliedSize = appletPreferredLength(minSize, prefSize, maxSize);
+        } else if (noOfApplets == 1) {
+            //! at this step if only one applet has remained for which the max size is not null,
+            //! then for this applet we make sure the maximum size does not exceed the available space
+            //! in order for the applet to not be drawn outside the boundaries
+            appliedSize = appletPreferredLength(minSize, prefSize, qMin(maxSize, sizePerApplet));
+        }
+
+        //! appliedSize is valid and is also lower than the availableSpace, if it is not lower then
+        //! for this applet the needed space will be provided as a second pass in a fair way
+        //! between all remained applets that did not gain a valid fill space
+        if (appliedSize >= 0 && appliedSize <= sizePerApplet) {
+            int properSize = toFillLength(qMin(appliedSize, availableSpace));
+
+            if (inMaxAutoFillCalculations) {
+                applet.maxAutoFillLength = properSize;
+            } else {
+                applet.minAutoFillLength = properSize;
+            }
+
+            applet.inFillCalculations = false;
+            availableSpace = qMax((qreal)0, availableSpace - applet.maxAutoFillLength);
+            noOfApplets = noOfApplets - 1;
+            sizePerApplet = noOfApplets > 1 ? qFloor(availableSpace / noOfApplets) : availableSpace;
+        }
+    }
+}
+
+//! during step2/pass2 all the applets with fills
+//! that remained with no computations from pass1
+//! are updated with the algorithm's proposed size
+void FillLayouter::computeStep2ForLayout(FillLayoutData &layout, const qreal &sizePerApplet, const int &noOfApplets, const bool &inMaxAutoFillCalculations)
+{
+    if (sizePerApplet < 0) {
+        return;
+    }
+
+    if (noOfApplets != 0) {
+        for (auto &applet : layout.applets) {
+            if (!applet.inFillCalculations) {
+                continue;
+            }
+
+            int length = toFillLength(qMax(applet.minimumLength, sizePerApplet));
+
+            if (inMaxAutoFillCalculations) {
+                applet.maxAutoFillLength = length;
+            } else {
+                applet.minAutoFillLength = length;
+            }
+
+            applet.inFillCalculations = false;
+        }
+
+        return;
+    }
+
+    //! when all applets have assigned some size and there is still free space, we must find
+    //! the most demanding space applet and assign the remaining space to it
+    FillAppletData *mostDemandingApplet{nullptr};
+    int mostDemandingAppletSize = 0;
+
+    //! applets with no strong opinion
+    QVector<FillAppletData *> neutralApplets;
+
+    for (auto &applet : layout.applets) {
+        if (!applet.hasMetrics) {
+            continue;
+        }
+
+        //! the most demanding applet is the one that has maximum size set to Infinity
+        //! AND is not Neutral, meaning that it provided some valid metrics
+        //! AND at the same time gained from step one the biggest space
+        bool isNeutral = (applet.minimumLength <= 0 && applet.preferredLength <= 0);
+        int currentSize = inMaxAutoFillCalculations ? applet.maxAutoFillLength : applet.minAutoFillLength;
+
+        if (!isNeutral && currentSize > mostDemandingAppletSize) {
+            mostDemandingApplet = &applet;
+            mostDemandingAppletSize = currentSize;
+        } else if (isNeutral) {
+            neutralApplets << &applet;
+        }
+    }
+
+    if (mostDemandingApplet) {
+        //! the most demanding applet gains all the remaining space
+        if (inMaxAutoFillCalculations) {
+            mostDemandingApplet->maxAutoFillLength = toFillLength(mostDemandingApplet->maxAutoFillLength + sizePerApplet);
+        } else {
+            mostDemandingApplet->minAutoFillLength = toFillLength(mostDemandingApplet->minAutoFillLength + sizePerApplet);
+        }
+    } else if (neutralApplets.count() > 0) {
+        //! if no demanding applets was found then the available space is splitted equally
+        //! between all neutralApplets
+        qreal adjustedAppletSize = sizePerApplet / neutralApplets.count();
+
+        for (auto applet : neutralApplets) {
+            if (inMaxAutoFillCalculations) {
+                applet->maxAutoFillLength = toFillLength(applet->maxAutoFillLength + adjustedAppletSize);
+            } else {
+                applet->minAutoFillLength = toFillLength(applet->minAutoFillLength + adjustedAppletSize);
+            }
+        }
+    }
+}
+
+void FillLayouter::updateFillAppletsWithOneStep(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                                const bool &justify, const int &maxLength, const bool &inMaxAutoFillCalculations)
+{
+    int noA = start.fillApplets + main.fillApplets + end.fillApplets;
+
+    qreal availableSpace = qMax(0, maxLength - start.sizeWithNoFillApplets - main.sizeWithNoFillApplets - end.sizeWithNoFillApplets);
+    qreal sizePerApplet = availableSpace / noA;
+
+    //! initialize the three layouts and execute the step1/phase1
+    //! start and end layouts are used only in Justify alignment
+    if (justify) {
+        initLayoutForFillsCalculations(start);
+        initLayoutForFillsCalculations(end);
+    }
+    initLayoutForFillsCalculations(main);
+
+    //! first pass in order to update sizes for applet that want to fill space
+    //! but their maximum metrics are lower than the sizePerApplet
+    computeStep1ForLayout(main, availableSpace, sizePerApplet, noA, inMaxAutoFillCalculations);
+
+    if (justify) {
+        computeStep1ForLayout(start, availableSpace, sizePerApplet, noA, inMaxAutoFillCalculations);
+        computeStep1ForLayout(end, availableSpace, sizePerApplet, noA, inMaxAutoFillCalculations);
+    }
+
+    //! after step1 there is a chance that all applets were assigned a valid space
+    //! but at the same time some space remained free. In such case we make sure
+    //! that remained space will be assigned to the most demanding applet.
+    //! This is achieved by <layout>No values. For step2 passing value!=0
+    //! means default step2 behavior BUT value=0 means that remained space
+    //! must be also assigned at the end.
+    bool remainedSpace = (noA == 0 && sizePerApplet > 0);
+
+    int startNo = -1;
+    int mainNo = -1;
+    int endNo = -1;
+
+    if (remainedSpace) {
+        if (start.fillApplets > 0) {
+            startNo = 0;
+        } else if (end.fillApplets > 0) {
+            endNo = 0;
+        } else if (main.fillApplets > 0) {
+            mainNo = 0;
+        }
+    }
+
+    //! second pass in order to update sizes for applet that want to fill space
+    //! these applets get the direct division of the available free space that
+    //! remained from step1 OR the the free available space that no applet requested yet
+    computeStep2ForLayout(start, sizePerApplet, startNo, inMaxAutoFillCalculations);
+    computeStep2ForLayout(main, sizePerApplet, mainNo, inMaxAutoFillCalculations);
+    computeStep2ForLayout(end, sizePerApplet, endNo, inMaxAutoFillCalculations);
+}
+
+void FillLayouter::updateFillAppletsWithTwoSteps(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                                 const int &maxLength, const bool &inMaxAutoFillCalculations)
+{
+    int noA = start.fillApplets + main.fillApplets + end.fillApplets;
+
+    //! compute the two free spaces around the centered layout
+    //! they are called start and end accordingly
+    qreal halfMainLayout = main.sizeWithNoFillApplets / 2.0;
+    qreal availableSpaceStart = qMax((qreal)0, maxLength/2.0 - start.sizeWithNoFillApplets - halfMainLayout);
+    qreal availableSpaceEnd = qMax((qreal)0, maxLength/2.0 - end.sizeWithNoFillApplets - halfMainLayout);
+    qreal availableSpace;
+
+    if (main.fillApplets == 0 || (start.shownApplets == 0 && end.shownApplets == 0)) {
+        //! no fill applets in main OR we are in alignment that all applets are in main
+        availableSpace = availableSpaceStart + availableSpaceEnd - main.sizeWithNoFillApplets;
+    } else {
+        //! use the minimum available space in order to avoid overlaps
+        availableSpace = 2 * qMin(availableSpaceStart, availableSpaceEnd) - main.sizeWithNoFillApplets;
+    }
+
+    qreal sizePerAppletMain = main.fillApplets > 0 ? availableSpace / noA : 0;
+
+    int noStart = start.fillApplets;
+    int noMain = main.fillApplets;
+    int noEnd = end.fillApplets;
+
+    //! initialize the computations
+    initLayoutForFillsCalculations(start);
+    initLayoutForFillsCalculations(main);
+    initLayoutForFillsCalculations(end);
+
+    //! first pass
+    if (main.fillApplets > 0) {
+        qreal mainAvailableSpace = availableSpace;
+        computeStep1ForLayout(main, mainAvailableSpace, sizePerAppletMain, noMain, inMaxAutoFillCalculations);
+        qreal dif = (availableSpace - mainAvailableSpace) / 2;
+        availableSpaceStart = availableSpaceStart - dif;
+        availableSpaceEnd = availableSpaceEnd - dif;
+    }
+
+    qreal sizePerAppletStart = start.fillApplets > 0 ? availableSpaceStart / noStart : 0;
+    qreal sizePerAppletEnd = end.fillApplets > 0 ? availableSpaceEnd / noEnd : 0;
+
+    if (start.fillApplets > 0) {
+        computeStep1ForLayout(start, availableSpaceStart, sizePerAppletStart, noStart, inMaxAutoFillCalculations);
+    }
+
+    if (end.fillApplets > 0) {
+        computeStep1ForLayout(end, availableSpaceEnd, sizePerAppletEnd, noEnd, inMaxAutoFillCalculations);
+    }
+
+    //! second pass
+    if (start.fillApplets > 0) {
+        if (main.fillApplets > 0) {
+            //! finally adjust ALL startLayout fill applets size in mainlayouts final length
+            noStart = start.fillApplets;
+            sizePerAppletStart = ((maxLength/2.0) - (main.length/2.0) - start.sizeWithNoFillApplets) / noStart;
+        }
+
+        computeStep2ForLayout(start, sizePerAppletStart, noStart, inMaxAutoFillCalculations);
+    }
+
+    if (end.fillApplets > 0) {
+        if (main.fillApplets > 0) {
+            //! finally adjust ALL endLayout fill applets size in mainlayouts final length
+            noEnd = end.fillApplets;
+            sizePerAppletEnd = ((maxLength/2.0) - (main.length/2.0) - end.sizeWithNoFillApplets) / noEnd;
+        }
+
+        computeStep2ForLayout(end, sizePerAppletEnd, noEnd, inMaxAutoFillCalculations);
+    }
+
+    if (main.fillApplets > 0) {
+        qreal halfRemained = (maxLength/2.0) - (main.length/2.0);
+        qreal freeSpaceAfterStart = halfRemained - start.length;
+        qreal freeSpaceBeforeEnd = halfRemained - end.length;
+
+        if (freeSpaceAfterStart > 0 && freeSpaceBeforeEnd > 0) {
+            qreal minimumHalfAppletSizePossible = qMin(freeSpaceAfterStart, freeSpaceBeforeEnd);
+            sizePerAppletMain = qMax((qreal)0, (minimumHalfAppletSizePossible * 2) / main.fillApplets);
+
+            computeStep2ForLayout(main, sizePerAppletMain, noMain, inMaxAutoFillCalculations);
+        }
+    }
+}
+
+void FillLayouter::computeFillLengths(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                      const bool &justify, const int &contentsMaxLength, const int &minLength)
+{
+    int noA = start.fillApplets + main.fillApplets + end.fillApplets;
+
+    if (noA == 0) {
+        return;
+    }
+
+    //! maximum lengths are always computed first because the minimum lengths pass
+    //! consumes the available space based on the applets maximum lengths
+    if (main.shownApplets == 0 || !justify) {
+        updateFillAppletsWithOneStep(start, main, end, justify, contentsMaxLength, true);
+        updateFillAppletsWithOneStep(start, main, end, justify, minLength, false);
+    } else {
+        //! Justify mode in all remaining cases
+        updateFillAppletsWithTwoSteps(start, main, end, contentsMaxLength, true);
+        updateFillAppletsWithTwoSteps(start, main, end, minLength, false);
+    }
+}
+
+void FillLayouter::updateSizeForAppletsInFill(const bool &justify, const int &contentsMaxLength, const int &minLength)
+{
+    FillLayoutData start = layoutData(m_startContainer);
+    FillLayoutData main = layoutData(m_mainContainer);
+    FillLayoutData end = layoutData(m_endContainer);
+
+    if (start.fillApplets + main.fillApplets + end.fillApplets == 0) {
+        return;
+    }
+
+    computeFillLengths(start, main, end, justify, contentsMaxLength, minLength);
+
+    applyLayoutData(start);
+    applyLayoutData(main);
+    applyLayoutData(end);
+}
+
+}
+}
@@ -0,0 +1,105 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef CONTAINMENTFILLLAYOUTER_H
+#define CONTAINMENTFILLLAYOUTER_H
+
+//Qt
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVector>
+
+namespace Latte{
+namespace Containment{
+
+//! compact record of an applet that is requesting fillWidth/fillHeight
+struct FillAppletData
+{
+    qreal minimumLength{-1};
+    qreal preferredLength{-1};
+    qreal maximumLength{-1};
+
+    int minAutoFillLength{-1};
+    int maxAutoFillLength{-1};
+
+    bool hasMetrics{false};   //applet or internal splitter
+    bool inFillCalculations{false};
+
+    QPointer<QQuickItem> item;
+};
+
+//! fill applets of one of the start/main/end layouts
+struct FillLayoutData
+{
+    int fillApplets{0};
+    int shownApplets{0};
+    int sizeWithNoFillApplets{0};
+    int length{0};
+
+    QVector<FillAppletData> applets;
+};
+
+//! Computes the lengths of all applets that are requesting fillWidth/fillHeight
+//! for the three containment layouts in one call. It replaces the multi-pass
+//! js loops that were used in LayouterPrivate.qml and it only writes back
+//! the min/maxAutoFillLength values that actually changed
+class FillLayouter : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QQuickItem *startContainer READ startContainer WRITE setStartContainer NOTIFY startContainerChanged)
+    Q_PROPERTY(QQuickItem *mainContainer READ mainContainer WRITE setMainContainer NOTIFY mainContainerChanged)
+    Q_PROPERTY(QQuickItem *endContainer READ endContainer WRITE setEndContainer NOTIFY endContainerChanged)
+
+public:
+    FillLayouter(QObject *parent = nullptr);
+
+    QQuickItem *startContainer() const;
+    void setStartContainer(QQuickItem *container);
+
+    QQuickItem *mainContainer() const;
+    void setMainContainer(QQuickItem *container);
+
+    QQuickItem *endContainer() const;
+    void setEndContainer(QQuickItem *container);
+
+    //! pure computation used by updateSizeForAppletsInFill(), both maximum and minimum fill lengths are computed
+    static void computeFillLengths(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                   const bool &justify, const int &contentsMaxLength, const int &minLength);
+
+public slots:
+    Q_INVOKABLE void updateSizeForAppletsInFill(const bool &justify, const int &contentsMaxLength, const int &minLength);
+
+signals:
+    void startContainerChanged();
+    void mainContainerChanged();
+    void endContainerChanged();
+
+private:
+    static int toFillLength(const qreal &length);
+    static qreal appletPreferredLength(qreal min, qreal pref, qreal max);
+
+    static void initLayoutForFillsCalculations(FillLayoutData &layout);
+    static void computeStep1ForLayout(FillLayoutData &layout, qreal &availableSpace, qreal &sizePerApplet, int &noOfApplets, const bool &inMaxAutoFillCalculations);
+    static void computeStep2ForLayout(FillLayoutData &layout, const qreal &sizePerApplet, const int &noOfApplets, const bool &inMaxAutoFillCalculations);
+
+    static void updateFillAppletsWithOneStep(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                             const bool &justify, const int &maxLength, const bool &inMaxAutoFillCalculations);
+    static void updateFillAppletsWithTwoSteps(FillLayoutData &start, FillLayoutData &main, FillLayoutData &end,
+                                              const int &maxLength, const bool &inMaxAutoFillCalculations);
+
+    FillLayoutData layoutData(QQuickItem *container) const;
+    void applyLayoutData(const FillLayoutData &layout);
+
+private:
+    QQuickItem *m_startContainer{nullptr};
+    QQuickItem *m_mainContainer{nullptr};
+    QQuickItem *m_endContainer{nullptr};
+};
+
+}
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include "lattecontainmentplugin.h"
 
 // local
+#include "filllayouter.h"
 #include "layoutmanager.h"
 #include "types.h"
 
@@ -16,6 +17,7 @@ void LatteContainmentPlugin::registerTypes(const char *uri)
 {
     Q_ASSERT(uri == QLatin1String("org.kde.latte.private.containment"));
     qmlRegisterUncreatableType<Latte::Containment::Types>(uri, 0, 1, "Types", "Latte Containment Types uncreatable");
+    qmlRegisterType<Latte::Containment::FillLayouter>(uri, 0, 1, "FillLayouter");
     qmlRegisterType<Latte::Containment::LayoutManager>(uri, 0, 1, "LayoutManager");
 }
 
@@ -27,20 +27,6 @@
 #include <Plasma/Corona>
 #include <Plasma/ServiceJob>
 
-const int MEMORYINDEX = 0;
-const int ACTIVELAYOUTSINDEX = 1;
-const int CURRENTLAYOUTSINDEX = 2;
-const int ACTIONSALWAYSSHOWN = 3;
-const int LAYOUTMENUINDEX = 4;
-const int VIEWLAYOUTINDEX = 5;
-const int VIEWTYPEINDEX = 6;
-
-enum LayoutsMemoryUsage
-{
-    SingleLayout = 0,
-    MultipleLayouts
-};
-
 enum LatteConfigPage
 {
     LayoutPage = 0,
@@ -220,22 +206,21 @@ QList<QAction *> Menu::contextualActions()
     }
     actions << m_actions[Latte::Data::ContextMenu::EDITVIEWACTION];
 
-    m_data.clear();
     m_viewTemplates.clear();
     QDBusInterface iface("org.kde.lattedock", "/Latte", "", QDBusConnection::sessionBus());
 
     if (iface.isValid()) {
-        QDBusReply<QStringList> contextData = iface.call("contextMenuData", containment()->id());
-        m_data = contextData.value();
+        //! layouts data are sent only when they changed since the last time the menu was shown
+        QDBusReply<QVariantMap> state = iface.call("contextMenuState", containment()->id(), m_stateVersion);
+
+        if (state.isValid()) {
+            updateState(state.value());
+        }
 
         QDBusReply<QStringList> templatesData = iface.call("viewTemplatesData");
         m_viewTemplates = templatesData.value();
     }
 
-    m_actionsAlwaysShown = m_data[ACTIONSALWAYSSHOWN].split(";;");
-
-    updateViewData();
-
     QString configureActionText = (m_view.type == DockView) ? i18n("&Edit Dock...") : i18n("&Edit Panel...");
     if (m_view.isCloned) {
         configureActionText = (m_view.type == DockView) ? i18n("&Edit Original Dock...") : i18n("&Edit Original Panel...");
@@ -248,7 +233,6 @@ QList<QAction *> Menu::contextualActions()
     const QString exportTemplateText = (m_view.type == DockView) ? i18n("E&xport Dock as Template") : i18n("E&xport Panel as Template");
     m_actions[Latte::Data::ContextMenu::EXPORTVIEWTEMPLATEACTION]->setText(exportTemplateText);
 
-    m_activeLayoutNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
     const QString moveText = (m_view.type == DockView) ? i18n("&Move Dock To Layout") : i18n("&Move Panel To Layout");
     m_actions[Latte::Data::ContextMenu::MOVEVIEWACTION]->setText(moveText);
 
@@ -317,32 +301,13 @@ void Menu::populateLayouts()
 {
     m_switchLayoutsMenu->clear();
 
-    LayoutsMemoryUsage memoryUsage = static_cast<LayoutsMemoryUsage>((m_data[MEMORYINDEX]).toInt());
-    QStringList activeNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
-    QStringList currentNames = m_data[CURRENTLAYOUTSINDEX].split(";;");
-
-    QList<LayoutInfo> layoutsmenulist;
-
-    QStringList layoutsdata = m_data[LAYOUTMENUINDEX].split(";;");
-
-    for (int i=0; i<layoutsdata.count(); ++i) {
-        QStringList cdata = layoutsdata[i].split("**");
-
-        LayoutInfo info;
-        info.layoutName = cdata[0];
-        info.isBackgroundFileIcon = cdata[1].toInt();
-        info.iconName = cdata[2];
-
-        layoutsmenulist << info;
-    }
+    const QList<LayoutInfo> &layoutsmenulist = m_layoutsMenu;
 
     for (int i = 0; i < layoutsmenulist.count(); ++i) {
-        bool isActive = activeNames.contains(layoutsmenulist[i].layoutName);
-
-        QString layoutText = layoutsmenulist[i].layoutName;
+        bool isActive = m_activeLayoutNames.contains(layoutsmenulist[i].layoutName);
 
-        bool isCurrent = ((memoryUsage == SingleLayout && isActive)
-                          || (memoryUsage == MultipleLayouts && currentNames.contains(layoutsmenulist[i].layoutName)));
+        bool isCurrent = ((m_memoryUsage == SingleLayout && isActive)
+                          || (m_memoryUsage == MultipleLayouts && m_currentLayoutNames.contains(layoutsmenulist[i].layoutName)));
 
 
         QWidgetAction *action = new QWidgetAction(m_switchLayoutsMenu);
@@ -375,31 +340,11 @@ void Menu::populateMoveToLayouts()
 {
     m_moveToLayoutMenu->clear();
 
-    LayoutsMemoryUsage memoryUsage = static_cast<LayoutsMemoryUsage>((m_data[MEMORYINDEX]).toInt());
-
-    if (memoryUsage == LayoutsMemoryUsage::MultipleLayouts) {
-        QStringList activeNames = m_data[ACTIVELAYOUTSINDEX].split(";;");
-        QStringList currentNames = m_data[CURRENTLAYOUTSINDEX].split(";;");
-        QString viewLayoutName = m_data[VIEWLAYOUTINDEX];
-
-        QList<LayoutInfo> layoutsmenulist;
-
-        QStringList layoutsdata = m_data[LAYOUTMENUINDEX].split(";;");
-
-        for (int i=0; i<layoutsdata.count(); ++i) {
-            QStringList cdata = layoutsdata[i].split("**");
-
-            LayoutInfo info;
-            info.layoutName = cdata[0];
-            info.isBackgroundFileIcon = cdata[1].toInt();
-            info.iconName = cdata[2];
-
-            layoutsmenulist << info;
-        }
+    if (m_memoryUsage == LayoutsMemoryUsage::MultipleLayouts) {
+        const QList<LayoutInfo> &layoutsmenulist = m_layoutsMenu;
 
         for (int i = 0; i < layoutsmenulist.count(); ++i) {
-            bool isCurrent = currentNames.contains(layoutsmenulist[i].layoutName) && activeNames.contains(layoutsmenulist[i].layoutName);
-            bool isViewCurrentLayout = layoutsmenulist[i].layoutName == viewLayoutName;
+            bool isViewCurrentLayout = layoutsmenulist[i].layoutName == m_viewLayoutName;
 
             QWidgetAction *action = new QWidgetAction(m_moveToLayoutMenu);
             action->setText(layoutsmenulist[i].layoutName);
@@ -415,12 +360,38 @@ void Menu::populateMoveToLayouts()
     }
 }
 
-void Menu::updateViewData()
+void Menu::updateState(const QVariantMap &state)
 {
-    QStringList vdata = m_data[VIEWTYPEINDEX].split(";;");
-    m_view.type = static_cast<ViewType>((vdata[0]).toInt());
-    m_view.isCloned = vdata[1].toInt();
-    m_view.clonesCount = vdata[2].toInt();
+    uint version = state.value(Latte::Data::ContextMenu::STATEVERSIONKEY).toUInt();
+
+    if (version != m_stateVersion && state.contains(Latte::Data::ContextMenu::STATEMENULAYOUTSKEY)) {
+        m_stateVersion = version;
+
+        m_memoryUsage = static_cast<LayoutsMemoryUsage>(state.value(Latte::Data::ContextMenu::STATEMEMORYUSAGEKEY).toInt());
+        m_activeLayoutNames = state.value(Latte::Data::ContextMenu::STATEACTIVELAYOUTSKEY).toStringList();
+        m_currentLayoutNames = state.value(Latte::Data::ContextMenu::STATECURRENTLAYOUTSKEY).toStringList();
+        m_actionsAlwaysShown = state.value(Latte::Data::ContextMenu::STATEACTIONSALWAYSSHOWNKEY).toStringList();
+
+        QStringList layoutnames = state.value(Latte::Data::ContextMenu::STATEMENULAYOUTSKEY).toStringList();
+        QStringList layouticons = state.value(Latte::Data::ContextMenu::STATEMENULAYOUTSICONSKEY).toStringList();
+        QStringList backgroundicons = state.value(Latte::Data::ContextMenu::STATEMENULAYOUTSBACKGROUNDICONSKEY).toStringList();
+
+        m_layoutsMenu.clear();
+
+        for (int i=0; i<layoutnames.count() && i<layouticons.count(); ++i) {
+            LayoutInfo info;
+            info.layoutName = layoutnames[i];
+            info.isBackgroundFileIcon = backgroundicons.contains(layoutnames[i]);
+            info.iconName = layouticons[i];
+
+            m_layoutsMenu << info;
+        }
+    }
+
+    m_viewLayoutName = state.value(Latte::Data::ContextMenu::STATEVIEWLAYOUTKEY).toString();
+    m_view.type = static_cast<ViewType>(state.value(Latte::Data::ContextMenu::STATEVIEWTYPEKEY).toInt());
+    m_view.isCloned = state.value(Latte::Data::ContextMenu::STATEVIEWISCLONEDKEY).toBool();
+    m_view.clonesCount = state.value(Latte::Data::ContextMenu::STATEVIEWCLONESCOUNTKEY).toInt();
 }
 
 void Menu::populateViewTemplates()
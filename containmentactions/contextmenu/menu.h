@@ -8,6 +8,7 @@
 
 // Qt
 #include <QObject>
+#include <QVariantMap>
 
 // Plasma
 #include <Plasma/ContainmentActions>
@@ -15,6 +16,12 @@
 class QAction;
 class QMenu;
 
+enum LayoutsMemoryUsage
+{
+    SingleLayout = 0,
+    MultipleLayouts
+};
+
 enum ViewType
 {
     DockView = 0,
@@ -52,7 +59,6 @@ private Q_SLOTS:
     void quitApplication();
     void requestConfiguration();
     void requestWidgetExplorer();
-    void updateViewData();
     void updateVisibleActions();
 
     void addView(QAction *action);
@@ -60,11 +66,22 @@ private Q_SLOTS:
     void switchToLayout(QAction *action);
 
 private:
-    QStringList m_data;
+    void updateState(const QVariantMap &state);
+
+private:
+    //! version of the layouts related state that the menu already has
+    uint m_stateVersion{0};
+
+    LayoutsMemoryUsage m_memoryUsage{LayoutsMemoryUsage::SingleLayout};
+
     QStringList m_viewTemplates;
 
     QStringList m_actionsAlwaysShown;
     QStringList m_activeLayoutNames;
+    QStringList m_currentLayoutNames;
+    QString m_viewLayoutName;
+
+    QList<LayoutInfo> m_layoutsMenu;
 
     ViewTypeData m_view;
 
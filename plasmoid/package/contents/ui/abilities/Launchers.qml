@@ -115,7 +115,10 @@ Item {
 
         tasksModel.requestAddLauncher(launcherUrl);
         launchers.launcherChanged(launcherUrl);
-        tasksModel.syncLaunchers();
+
+        if (!syncer.isApplyingDiff) {
+            tasksModel.syncLaunchers();
+        }
     }
 
     function addDroppedLaunchers(urls) {
@@ -132,6 +135,22 @@ Item {
         }
     }
 
+    //! all launchers changes requested between begin and commit are delivered
+    //! to synced task managers as one diff and are stored only once
+    function beginLaunchersBatch() {
+        if (bridge) {
+            bridge.launchers.host.beginSyncedBatch(syncer.clientId,
+                                                   launchers.group,
+                                                   launchers.groupId);
+        }
+    }
+
+    function commitLaunchersBatch() {
+        if (bridge) {
+            bridge.launchers.host.commitSyncedBatch(syncer.clientId);
+        }
+    }
+
     function addInternalSeparatorAtPos(pos) {
         var separatorName = freeAvailableSeparatorName();
 
@@ -329,6 +348,28 @@ Item {
         }
     }
 
+    function storeLauncherList() {
+        if (bridge && bridge.launchers.host.isReady) {
+            if (!_launchers.inUniqueGroup()) {
+                if (_launchers.inLayoutGroup()) {
+                    bridge.launchers.host.setLayoutLaunchers(_launchers.tasksModel.launcherList);
+                } else if (_launchers.inGlobalGroup()) {
+                    bridge.launchers.host.setUniversalLaunchers(_launchers.tasksModel.launcherList);
+                }
+            } else {
+                plasmoid.configuration.launchers59 = _launchers.tasksModel.launcherList;
+            }
+
+            if (inDraggingPhase) {
+                _launchers.validateSyncedLaunchersOrder();
+            }
+        } else if (!appletAbilities.myView.isReady) {
+            // This way we make sure that a delayed view.layout initialization does not store irrelevant launchers from different
+            // group to UNIQUE launchers group
+            plasmoid.configuration.launchers59 = _launchers.tasksModel.launcherList;
+        }
+    }
+
 
     //! Connections
     Component.onCompleted: {
@@ -379,24 +420,8 @@ Item {
     Connections {
         target: _launchers.tasksModel
         onLauncherListChanged: {
-            if (bridge && bridge.launchers.host.isReady) {
-                if (!_launchers.inUniqueGroup()) {
-                    if (_launchers.inLayoutGroup()) {
-                        bridge.launchers.host.setLayoutLaunchers(_launchers.tasksModel.launcherList);
-                    } else if (_launchers.inGlobalGroup()) {
-                        bridge.launchers.host.setUniversalLaunchers(_launchers.tasksModel.launcherList);
-                    }
-                } else {
-                    plasmoid.configuration.launchers59 = _launchers.tasksModel.launcherList;
-                }
-
-                if (inDraggingPhase) {
-                    _launchers.validateSyncedLaunchersOrder();
-                }
-            } else if (!appletAbilities.myView.isReady) {
-                // This way we make sure that a delayed view.layout initialization does not store irrelevant launchers from different
-                // group to UNIQUE launchers group
-                plasmoid.configuration.launchers59 = _launchers.tasksModel.launcherList;
+            if (!syncer.isApplyingDiff) {
+                _launchers.storeLauncherList();
             }
         }
     }
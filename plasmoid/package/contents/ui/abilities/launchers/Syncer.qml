@@ -12,6 +12,7 @@ import org.kde.latte.core 0.2 as LatteCore
 Item {
     id:_syncer
     property bool isBlocked: false
+    property bool isApplyingDiff: false
     readonly property bool isActive: bridge !== null && bridge.launchers.host !==null
     readonly property int clientId: plasmoid.id
     // used to identify launchers that need to be synced event though their launchers group type
@@ -98,6 +99,49 @@ Item {
         }
     }
 
+    function applySyncedLaunchersDiff(group, diff) {
+        if (group !== _launchers.group) {
+            return;
+        }
+
+        //! launchers are stored only once after the whole diff has been applied
+        isApplyingDiff = true;
+
+        for (var i=0; i<diff.length; ++i) {
+            var record = diff[i];
+
+            if (record.action === "add") {
+                tasksModel.requestAddLauncher(record.launcher);
+                _launchers.launcherChanged(record.launcher);
+            } else if (record.action === "remove") {
+                _launchers.launcherInRemoving(record.launcher);
+                tasksModel.requestRemoveLauncher(record.launcher);
+                _launchers.launcherChanged(record.launcher);
+            } else if (record.action === "addToActivity") {
+                if (record.activity !== activityInfo.currentActivity && _launchers.isOnAllActivities(record.launcher)) {
+                    _launchers.launcherInRemoving(record.launcher);
+                }
+
+                tasksModel.requestAddLauncherToActivity(record.launcher, record.activity);
+                _launchers.launcherChanged(record.launcher);
+            } else if (record.action === "removeFromActivity") {
+                if (record.activity === activityInfo.currentActivity) {
+                    _launchers.launcherInRemoving(record.launcher);
+                }
+
+                tasksModel.requestRemoveLauncherFromActivity(record.launcher, record.activity);
+                _launchers.launcherChanged(record.launcher);
+            } else if (record.action === "drop") {
+                _launchers.addDroppedLauncher(record.launcher);
+            }
+        }
+
+        isApplyingDiff = false;
+
+        tasksModel.syncLaunchers();
+        _launchers.storeLauncherList();
+    }
+
     function validateSyncedLaunchersOrder(group, orderedLaunchers) {
         if (group === _launchers.group && !isBlocked) {
             validator.stop();
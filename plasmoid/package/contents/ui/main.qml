@@ -295,15 +295,7 @@ Item {
     }
 
     function taskExists(url) {
-        var tasks = icList.contentItem.children;
-        for(var i=0; i<tasks.length; ++i){
-            var task = tasks[i];
-
-            if (task.launcherUrl===url && task.isWindow) {
-                return true;
-            }
-        }
-        return false;
+        return tasksRegistry.hasWindowForLauncher(url);
     }
 
 
@@ -613,48 +605,32 @@ Item {
         Component.onCompleted: previousActivity = currentActivity;
     }
 
+    LatteTasks.PlayersIndex {
+        id: playersIndex
+    }
+
+    LatteTasks.TasksRegistry {
+        id: tasksRegistry
+        container: icList
+        vertical: root.vertical
+    }
+
     PlasmaCore.DataSource {
         id: mpris2Source
         engine: "mpris2"
         connectedSources: sources
-        function sourceNameForLauncherUrl(launcherUrl, pid) {
-            if (!launcherUrl || launcherUrl === "") {
-                return "";
-            }
-
-            // MPRIS spec explicitly mentions that "DesktopEntry" is with .desktop extension trimmed
-            // Moreover, remove URL parameters, like wmClass (part after the question mark)
-            var desktopFileName = launcherUrl.toString().split('/').pop().split('?')[0].replace(".desktop", "")
-            if (desktopFileName.indexOf("applications:") === 0) {
-                desktopFileName = desktopFileName.substr(13)
-            }
 
-            for (var i = 0, length = connectedSources.length; i < length; ++i) {
-                var source = connectedSources[i];
-                // we intend to connect directly, otherwise the multiplexer steals the connection away
-                if (source === "@multiplex") {
-                    continue;
-                }
-
-                var sourceData = data[source];
-                if (!sourceData) {
-                    continue;
-                }
-
-                if (sourceData.DesktopEntry === desktopFileName || (pid && sourceData.InstancePid === pid)) {
-                    return source;
-                }
+        onNewData: playersIndex.updatePlayer(sourceName, data);
+        onSourceRemoved: playersIndex.removePlayer(source);
+        onSourceDisconnected: playersIndex.removePlayer(source);
 
-                var metadata = sourceData.Metadata;
-                if (metadata) {
-                    var kdePid = metadata["kde:pid"];
-                    if (kdePid && pid === kdePid) {
-                        return source;
-                    }
-                }
+        function sourceNameForLauncherUrl(launcherUrl, pid) {
+            //! revision is used only in order to reevaluate bindings when players are added, removed or changed
+            if (playersIndex.revision < 0 || !launcherUrl || launcherUrl === "") {
+                return "";
             }
 
-            return ""
+            return playersIndex.sourceNameForLauncherUrl(launcherUrl.toString(), pid ? pid : 0);
         }
 
         function startOperation(source, op) {
@@ -999,38 +975,15 @@ Item {
                     ///}
 
                     function childAtPos(x, y){
-                        var tasks = icList.contentItem.children;
-
-                        for(var i=0; i<tasks.length; ++i){
-                            var task = tasks[i];
-
-                            var choords = mapFromItem(task,0, 0);
-
-                            if( (task.objectName==="TaskItem") && (x>=choords.x) && (x<=choords.x+task.width)
-                                    && (y>=choords.y) && (y<=choords.y+task.height)){
-                                return task;
-                            }
-                        }
-
-                        return null;
+                        return tasksRegistry.taskAtPos(x, y);
                     }
 
                     function childAtIndex(position) {
-                        var tasks = icList.contentItem.children;
-
                         if (position < 0)
                             return;
 
-                        for(var i=0; i<tasks.length; ++i){
-                            var task = tasks[i];
-
-                            if (task.lastValidIndex === position
-                                    || (task.lastValidIndex === -1 && task.itemIndex === position )) {
-                                return task;
-                            }
-                        }
-
-                        return undefined;
+                        var task = tasksRegistry.taskAtIndex(position);
+                        return task ? task : undefined;
                     }
                 }
             } // ScrollPositioner
@@ -1214,13 +1167,13 @@ Item {
     }
 
     function updateBadge(identifier, value) {
-        var tasks = icList.contentItem.children;
         var identifierF = identifier.concat(".desktop");
+        var tasks = tasksRegistry.tasksForDesktopFile(identifierF);
 
         for(var i=0; i<tasks.length; ++i){
             var task = tasks[i];
 
-            if (task && task.launcherUrl && task.launcherUrl.indexOf(identifierF) >= 0) {
+            if (task) {
                 task.badgeIndicator = value === "" ? 0 : Number(value);
                 var badge = getBadger(identifierF);
                 if (badge) {
@@ -875,6 +875,8 @@ AbilityItem.BasicItem {
     ///// End of Helper functions ////
 
     Component.onCompleted: {
+        tasksRegistry.addTask(taskItem);
+
         parabolicItem.opacity = 0;
 
         root.draggingFinished.connect(handlerDraggingFinished);
@@ -904,6 +906,8 @@ AbilityItem.BasicItem {
     }
 
     Component.onDestruction: {
+        tasksRegistry.removeTask(taskItem);
+
         root.draggingFinished.disconnect(handlerDraggingFinished);
         root.publishTasksGeometries.disconnect(slotPublishGeometries);
         root.showPreviewForTasks.disconnect(slotShowPreviewForTasks);
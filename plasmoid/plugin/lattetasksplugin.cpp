@@ -6,6 +6,8 @@
 #include "lattetasksplugin.h"
 
 // local
+#include "playersindex.h"
+#include "tasksregistry.h"
 #include "types.h"
 
 // Qt
@@ -16,5 +18,7 @@ void LatteTasksPlugin::registerTypes(const char *uri)
 {
     Q_ASSERT(uri == QLatin1String("org.kde.latte.private.tasks"));
     qmlRegisterUncreatableType<Latte::Tasks::Types>(uri, 0, 1, "Types", "Latte Tasks Types uncreatable");
+    qmlRegisterType<Latte::Tasks::PlayersIndex>(uri, 0, 1, "PlayersIndex");
+    qmlRegisterType<Latte::Tasks::TasksRegistry>(uri, 0, 1, "TasksRegistry");
 }
 
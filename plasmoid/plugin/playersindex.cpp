@@ -0,0 +1,145 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "playersindex.h"
+
+#define MULTIPLEXSOURCE "@multiplex"
+
+namespace Latte {
+namespace Tasks {
+
+PlayersIndex::PlayersIndex(QObject *parent)
+    : QObject(parent)
+{
+}
+
+int PlayersIndex::revision() const
+{
+    return m_revision;
+}
+
+void PlayersIndex::updatePlayer(const QString &sourceName, const QVariantMap &data)
+{
+    //! the multiplexer is not a real player
+    if (sourceName == QLatin1String(MULTIPLEXSOURCE)) {
+        return;
+    }
+
+    PlayerRecord record;
+    record.desktopEntry = data.value(QStringLiteral("DesktopEntry")).toString();
+    record.instancePid = data.value(QStringLiteral("InstancePid")).toUInt();
+    record.kdePid = data.value(QStringLiteral("Metadata")).toMap().value(QStringLiteral("kde:pid")).toUInt();
+
+    if (m_players.contains(sourceName)) {
+        const PlayerRecord &previous = m_players[sourceName];
+
+        if (previous.desktopEntry == record.desktopEntry
+                && previous.instancePid == record.instancePid
+                && previous.kdePid == record.kdePid) {
+            //! playback, position and track updates do not change the index
+            return;
+        }
+
+        removeFromIndexes(sourceName, previous);
+    }
+
+    m_players[sourceName] = record;
+    addToIndexes(sourceName, record);
+
+    m_revision++;
+    emit revisionChanged();
+}
+
+void PlayersIndex::removePlayer(const QString &sourceName)
+{
+    if (!m_players.contains(sourceName)) {
+        return;
+    }
+
+    removeFromIndexes(sourceName, m_players.take(sourceName));
+
+    m_revision++;
+    emit revisionChanged();
+}
+
+void PlayersIndex::addToIndexes(const QString &sourceName, const PlayerRecord &record)
+{
+    if (!record.desktopEntry.isEmpty()) {
+        m_sourcesForDesktopEntry[record.desktopEntry] << sourceName;
+    }
+
+    if (record.instancePid > 0) {
+        m_sourcesForPid[record.instancePid] << sourceName;
+    }
+
+    if (record.kdePid > 0 && record.kdePid != record.instancePid) {
+        m_sourcesForPid[record.kdePid] << sourceName;
+    }
+}
+
+void PlayersIndex::removeFromIndexes(const QString &sourceName, const PlayerRecord &record)
+{
+    if (m_sourcesForDesktopEntry.contains(record.desktopEntry)) {
+        QStringList &sources = m_sourcesForDesktopEntry[record.desktopEntry];
+        sources.removeAll(sourceName);
+
+        if (sources.isEmpty()) {
+            m_sourcesForDesktopEntry.remove(record.desktopEntry);
+        }
+    }
+
+    for (const auto pid : {record.instancePid, record.kdePid}) {
+        if (!m_sourcesForPid.contains(pid)) {
+            continue;
+        }
+
+        QStringList &sources = m_sourcesForPid[pid];
+        sources.removeAll(sourceName);
+
+        if (sources.isEmpty()) {
+            m_sourcesForPid.remove(pid);
+        }
+    }
+}
+
+QString PlayersIndex::desktopEntryForLauncherUrl(const QString &launcherUrl)
+{
+    //! remove url parameters, like wmClass, and the path
+    QString desktopEntry = launcherUrl.section(QLatin1Char('/'), -1).section(QLatin1Char('?'), 0, 0);
+
+    int extension = desktopEntry.indexOf(QLatin1String(".desktop"));
+
+    if (extension >= 0) {
+        desktopEntry.remove(extension, 8);
+    }
+
+    if (desktopEntry.startsWith(QLatin1String("applications:"))) {
+        desktopEntry.remove(0, 13);
+    }
+
+    return desktopEntry;
+}
+
+QString PlayersIndex::sourceNameForLauncherUrl(const QString &launcherUrl, const uint &pid) const
+{
+    if (launcherUrl.isEmpty()) {
+        return QString();
+    }
+
+    QString desktopEntry = desktopEntryForLauncherUrl(launcherUrl);
+
+    if (m_sourcesForDesktopEntry.contains(desktopEntry)) {
+        return m_sourcesForDesktopEntry[desktopEntry].first();
+    }
+
+    if (pid > 0 && m_sourcesForPid.contains(pid)) {
+        return m_sourcesForPid[pid].first();
+    }
+
+    return QString();
+}
+
+}
+}
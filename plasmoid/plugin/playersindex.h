@@ -0,0 +1,72 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef LATTETASKSPLAYERSINDEX_H
+#define LATTETASKSPLAYERSINDEX_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QVariantMap>
+
+namespace Latte {
+namespace Tasks {
+
+//! identity of an mpris2 player as it is used in order to match it with tasks
+struct PlayerRecord
+{
+    QString desktopEntry;
+    uint instancePid{0};
+    uint kdePid{0};
+};
+
+//! Indexes the mpris2 dataengine players by desktop entry and pid. It is fed
+//! incrementally from the mpris2 datasource, so tasks find their player with
+//! hash lookups instead of scanning all players. The revision changes only
+//! when a player is added, removed or changes identity and not for playback
+//! or metadata updates, so bindings that depend on it are not reevaluated
+//! for every player update.
+class PlayersIndex : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int revision READ revision NOTIFY revisionChanged)
+
+public:
+    PlayersIndex(QObject *parent = nullptr);
+
+    int revision() const;
+
+    Q_INVOKABLE void updatePlayer(const QString &sourceName, const QVariantMap &data);
+    Q_INVOKABLE void removePlayer(const QString &sourceName);
+
+    Q_INVOKABLE QString sourceNameForLauncherUrl(const QString &launcherUrl, const uint &pid) const;
+
+signals:
+    void revisionChanged();
+
+private:
+    void addToIndexes(const QString &sourceName, const PlayerRecord &record);
+    void removeFromIndexes(const QString &sourceName, const PlayerRecord &record);
+
+    //! MPRIS desktop entries are the launcher desktop file names without extension
+    static QString desktopEntryForLauncherUrl(const QString &launcherUrl);
+
+private:
+    int m_revision{0};
+
+    //! source, player
+    QHash<QString, PlayerRecord> m_players;
+
+    //! desktop entry, sources in the order they appeared
+    QHash<QString, QStringList> m_sourcesForDesktopEntry;
+    //! pid, sources in the order they appeared
+    QHash<uint, QStringList> m_sourcesForPid;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,307 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#include "tasksregistry.h"
+
+// C++
+#include <algorithm>
+
+// Qt
+#include <QMetaProperty>
+
+namespace Latte {
+namespace Tasks {
+
+TasksRegistry::TasksRegistry(QObject *parent)
+    : QObject(parent)
+{
+}
+
+bool TasksRegistry::vertical() const
+{
+    return m_vertical;
+}
+
+void TasksRegistry::setVertical(bool vertical)
+{
+    if (m_vertical == vertical) {
+        return;
+    }
+
+    m_vertical = vertical;
+    m_positionsAreDirty = true;
+    emit verticalChanged();
+}
+
+QQuickItem *TasksRegistry::container() const
+{
+    return m_container;
+}
+
+void TasksRegistry::setContainer(QQuickItem *container)
+{
+    if (m_container == container) {
+        return;
+    }
+
+    m_container = container;
+    emit containerChanged();
+}
+
+void TasksRegistry::addTask(QQuickItem *task)
+{
+    if (!task || m_tasks.contains(task)) {
+        return;
+    }
+
+    m_tasks << task;
+
+    connect(task, &QObject::destroyed, this, &TasksRegistry::onTaskDestroyed);
+    connect(task, &QQuickItem::xChanged, this, &TasksRegistry::onTaskGeometryChanged);
+    connect(task, &QQuickItem::yChanged, this, &TasksRegistry::onTaskGeometryChanged);
+    connect(task, &QQuickItem::widthChanged, this, &TasksRegistry::onTaskGeometryChanged);
+    connect(task, &QQuickItem::heightChanged, this, &TasksRegistry::onTaskGeometryChanged);
+
+    connectProperty(task, "itemIndex", SLOT(onTaskIndexChanged()));
+    connectProperty(task, "lastValidIndex", SLOT(onTaskIndexChanged()));
+    connectProperty(task, "launcherUrl", SLOT(onTaskLauncherChanged()));
+    connectProperty(task, "isWindow", SLOT(onTaskLauncherChanged()));
+
+    m_positionsAreDirty = true;
+    m_indexesAreDirty = true;
+    m_launchersAreDirty = true;
+}
+
+void TasksRegistry::removeTask(QQuickItem *task)
+{
+    if (!task) {
+        return;
+    }
+
+    m_tasks.removeAll(task);
+    disconnect(task, nullptr, this, nullptr);
+
+    m_positionsAreDirty = true;
+    m_indexesAreDirty = true;
+    m_launchersAreDirty = true;
+}
+
+void TasksRegistry::connectProperty(QQuickItem *task, const char *property, const char *slot)
+{
+    //! task properties are declared in qml, so their notifiers are found through the meta object
+    int propertyIndex = task->metaObject()->indexOfProperty(property);
+
+    if (propertyIndex < 0) {
+        return;
+    }
+
+    QMetaMethod notifier = task->metaObject()->property(propertyIndex).notifySignal();
+
+    if (!notifier.isValid()) {
+        return;
+    }
+
+    //! SLOT() prefixes the method signature with its type code
+    int slotIndex = metaObject()->indexOfSlot(slot + 1);
+    connect(task, notifier, this, metaObject()->method(slotIndex));
+}
+
+void TasksRegistry::onTaskDestroyed()
+{
+    //! destroyed tasks are dropped from m_tasks automatically, indexes must not keep them
+    m_positionsAreDirty = true;
+    m_indexesAreDirty = true;
+    m_launchersAreDirty = true;
+}
+
+void TasksRegistry::onTaskGeometryChanged()
+{
+    m_positionsAreDirty = true;
+}
+
+void TasksRegistry::onTaskIndexChanged()
+{
+    m_indexesAreDirty = true;
+}
+
+void TasksRegistry::onTaskLauncherChanged()
+{
+    m_launchersAreDirty = true;
+}
+
+qreal TasksRegistry::axisStart(const QQuickItem *task) const
+{
+    return m_vertical ? task->y() : task->x();
+}
+
+qreal TasksRegistry::axisLength(const QQuickItem *task) const
+{
+    return m_vertical ? task->height() : task->width();
+}
+
+void TasksRegistry::updatePositions()
+{
+    if (!m_positionsAreDirty) {
+        return;
+    }
+
+    m_tasksByPosition.clear();
+    m_tasksByPosition.reserve(m_tasks.count());
+    m_maxAxisLength = 0;
+
+    for (const auto &task : m_tasks) {
+        if (task) {
+            m_tasksByPosition << task;
+            m_maxAxisLength = qMax(m_maxAxisLength, axisLength(task));
+        }
+    }
+
+    std::stable_sort(m_tasksByPosition.begin(), m_tasksByPosition.end(), [this](const QQuickItem *a, const QQuickItem *b) {
+        return axisStart(a) < axisStart(b);
+    });
+
+    m_positionsAreDirty = false;
+}
+
+void TasksRegistry::updateIndexes()
+{
+    if (!m_indexesAreDirty) {
+        return;
+    }
+
+    m_taskForIndex.clear();
+
+    for (const auto &task : m_tasks) {
+        if (!task) {
+            continue;
+        }
+
+        int lastValidIndex = task->property("lastValidIndex").toInt();
+        int index = (lastValidIndex != -1 ? lastValidIndex : task->property("itemIndex").toInt());
+
+        //! first registered task wins, same as the children order that was used before
+        if (!m_taskForIndex.contains(index)) {
+            m_taskForIndex[index] = task;
+        }
+    }
+
+    m_indexesAreDirty = false;
+}
+
+void TasksRegistry::updateLaunchers()
+{
+    if (!m_launchersAreDirty) {
+        return;
+    }
+
+    m_windowsForLauncher.clear();
+    m_tasksForDesktopFile.clear();
+
+    for (const auto &task : m_tasks) {
+        if (!task) {
+            continue;
+        }
+
+        QString launcherUrl = task->property("launcherUrl").toString();
+
+        if (launcherUrl.isEmpty()) {
+            continue;
+        }
+
+        if (task->property("isWindow").toBool()) {
+            m_windowsForLauncher[launcherUrl]++;
+        }
+
+        m_tasksForDesktopFile[desktopFileName(launcherUrl)] << task;
+    }
+
+    m_launchersAreDirty = false;
+}
+
+QString TasksRegistry::desktopFileName(const QString &launcherUrl)
+{
+    //! remove the path and url parameters, like wmClass
+    QString fileName = launcherUrl.section(QLatin1Char('/'), -1).section(QLatin1Char('?'), 0, 0);
+
+    if (fileName.startsWith(QLatin1String("applications:"))) {
+        fileName.remove(0, 13);
+    }
+
+    return fileName;
+}
+
+QQuickItem *TasksRegistry::taskAtPos(const qreal &x, const qreal &y)
+{
+    updatePositions();
+
+    if (m_tasksByPosition.isEmpty()) {
+        return nullptr;
+    }
+
+    //! all tasks share the same parent, so the point is mapped only once
+    QQuickItem *tasksParent = m_tasksByPosition.first()->parentItem();
+    QPointF point(x, y);
+
+    if (m_container && tasksParent && m_container != tasksParent) {
+        point = m_container->mapToItem(tasksParent, point);
+    }
+
+    qreal axisPos = m_vertical ? point.y() : point.x();
+
+    auto next = std::upper_bound(m_tasksByPosition.begin(), m_tasksByPosition.end(), axisPos, [this](const qreal &pos, const QQuickItem *task) {
+        return pos < axisStart(task);
+    });
+
+    //! only tasks that start before the point and are long enough to reach it are checked
+    for (auto it = next; it != m_tasksByPosition.begin(); ) {
+        --it;
+        QQuickItem *task = *it;
+
+        if (axisStart(task) + m_maxAxisLength < axisPos) {
+            break;
+        }
+
+        if (point.x() >= task->x() && point.x() <= task->x() + task->width()
+                && point.y() >= task->y() && point.y() <= task->y() + task->height()) {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+QQuickItem *TasksRegistry::taskAtIndex(const int &index)
+{
+    if (index < 0) {
+        return nullptr;
+    }
+
+    updateIndexes();
+
+    return m_taskForIndex.value(index, nullptr);
+}
+
+bool TasksRegistry::hasWindowForLauncher(const QString &launcherUrl)
+{
+    updateLaunchers();
+
+    return m_windowsForLauncher.value(launcherUrl, 0) > 0;
+}
+
+QVariantList TasksRegistry::tasksForDesktopFile(const QString &desktopFileName)
+{
+    updateLaunchers();
+
+    QVariantList tasks;
+
+    for (const auto task : m_tasksForDesktopFile.value(desktopFileName)) {
+        tasks << QVariant::fromValue(task);
+    }
+
+    return tasks;
+}
+
+}
+}
@@ -0,0 +1,101 @@
+/*
+    SPDX-FileCopyrightText: 2021 Michail Vourlakos <mvourlakos@gmail.com>
+    SPDX-License-Identifier: GPL-2.0-or-later
+*/
+
+#ifndef LATTETASKSREGISTRY_H
+#define LATTETASKSREGISTRY_H
+
+// Qt
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVariantList>
+#include <QVector>
+
+namespace Latte {
+namespace Tasks {
+
+//! Task items register themselves when they are created and unregister when
+//! they are destroyed. Lookups by position, index and launcher are served from
+//! indexes that are only marked dirty when a relevant task property changes and
+//! are rebuilt lazily on the next lookup. Tasks are kept sorted along the layout
+//! axis, so position lookups are binary searches instead of mapping every task
+//! to the container coordinates.
+class TasksRegistry : public QObject
+{
+    Q_OBJECT
+    //! item that position lookups coordinates are relative to
+    Q_PROPERTY(QQuickItem *container READ container WRITE setContainer NOTIFY containerChanged)
+    Q_PROPERTY(bool vertical READ vertical WRITE setVertical NOTIFY verticalChanged)
+
+public:
+    TasksRegistry(QObject *parent = nullptr);
+
+    bool vertical() const;
+    void setVertical(bool vertical);
+
+    QQuickItem *container() const;
+    void setContainer(QQuickItem *container);
+
+    Q_INVOKABLE void addTask(QQuickItem *task);
+    Q_INVOKABLE void removeTask(QQuickItem *task);
+
+    Q_INVOKABLE QQuickItem *taskAtPos(const qreal &x, const qreal &y);
+    //! based on lastValidIndex and on itemIndex when lastValidIndex is not set
+    Q_INVOKABLE QQuickItem *taskAtIndex(const int &index);
+
+    Q_INVOKABLE bool hasWindowForLauncher(const QString &launcherUrl);
+    Q_INVOKABLE QVariantList tasksForDesktopFile(const QString &desktopFileName);
+
+signals:
+    void containerChanged();
+    void verticalChanged();
+
+private slots:
+    void onTaskGeometryChanged();
+    void onTaskIndexChanged();
+    void onTaskLauncherChanged();
+    void onTaskDestroyed();
+
+private:
+    void connectProperty(QQuickItem *task, const char *property, const char *slot);
+
+    void updatePositions();
+    void updateIndexes();
+    void updateLaunchers();
+
+    qreal axisStart(const QQuickItem *task) const;
+    qreal axisLength(const QQuickItem *task) const;
+
+    static QString desktopFileName(const QString &launcherUrl);
+
+private:
+    bool m_vertical{false};
+
+    bool m_positionsAreDirty{true};
+    bool m_indexesAreDirty{true};
+    bool m_launchersAreDirty{true};
+
+    qreal m_maxAxisLength{0};
+
+    QPointer<QQuickItem> m_container;
+
+    //! registration order
+    QList<QPointer<QQuickItem>> m_tasks;
+
+    //! sorted along the layout axis
+    QVector<QQuickItem *> m_tasksByPosition;
+    QHash<int, QQuickItem *> m_taskForIndex;
+    //! launcher url, tasks that are windows
+    QHash<QString, int> m_windowsForLauncher;
+    //! desktop file name, tasks
+    QHash<QString, QList<QQuickItem *>> m_tasksForDesktopFile;
+};
+
+}
+}
+
+#endif